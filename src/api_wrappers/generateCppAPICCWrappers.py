@@ -33,6 +33,14 @@ class_method_template = '''
 
   JSON {method_name}(const JSON &input_params, const bool safe_to_retry) {{{nonce_code}
     return {method_name}({input_params}.toString(), safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}Async(const std::string &input_params, const bool safe_to_retry) {{
+    return DXHTTPRequestAsync("{route}", input_params, safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}Async(const JSON &input_params, const bool safe_to_retry) {{{nonce_code}
+    return {method_name}Async({input_params}.toString(), safe_to_retry);
   }}'''
 
 object_method_template = '''
@@ -42,6 +50,14 @@ object_method_template = '''
 
   JSON {method_name}(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {{{nonce_code}
     return {method_name}(object_id, {input_params}.toString(), safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}Async(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {{
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/{method_route}"), input_params, safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}Async(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {{{nonce_code}
+    return {method_name}Async(object_id, {input_params}.toString(), safe_to_retry);
   }}'''
 
 app_object_method_template = '''
@@ -59,6 +75,22 @@ app_object_method_template = '''
 
   JSON {method_name}WithAlias(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {{{nonce_code}
     return {method_name}WithAlias(app_name, app_alias, {input_params}.toString(), safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}Async(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {{
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/{method_route}"), input_params, safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}Async(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {{{nonce_code}
+    return {method_name}Async(app_id_or_name, {input_params}.toString(), safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}WithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {{
+    return {method_name}Async(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }}
+
+  std::future<JSON> {method_name}WithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {{{nonce_code}
+    return {method_name}WithAliasAsync(app_name, app_alias, {input_params}.toString(), safe_to_retry);
   }}'''
 
 postscript = '''
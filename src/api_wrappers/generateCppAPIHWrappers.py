@@ -30,7 +30,9 @@ preamble = r'''/** \file
  * JSON of an empty dict will be sent). safe_to_retry specifies whether the
  * request is idempotent and can be retried.
  *
- * Each function returns the JSON that is returned by the API server.
+ * Each function returns the JSON that is returned by the API server. The
+ * functions with an "Async" suffix return immediately, with a future for it
+ * instead (see dx::DXHTTPRequestAsync()).
  */
 
 // ===> Do not modify this file by hand! <===
@@ -42,6 +44,7 @@ preamble = r'''/** \file
 #ifndef DXCPP_API_H
 #define DXCPP_API_H
 
+#include <future>
 #include "dxjson/dxjson.h"
 
 namespace dx {'''
@@ -54,11 +57,15 @@ postscript = '''
 
 class_method_template = '''
   JSON {method_name}(const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
-  JSON {method_name}(const dx::JSON &input_params, const bool safe_to_retry={to_retry});'''
+  JSON {method_name}(const dx::JSON &input_params, const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}Async(const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}Async(const dx::JSON &input_params, const bool safe_to_retry={to_retry});'''
 
 object_method_template = '''
   JSON {method_name}(const std::string &object_id, const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
-  JSON {method_name}(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry={to_retry});'''
+  JSON {method_name}(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}Async(const std::string &object_id, const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}Async(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry={to_retry});'''
 
 # Overloads with alias are named differently to eliminate ambiguity between
 # method(app_id_or_name, input_params) and method(app_name, app_alias)
@@ -66,7 +73,11 @@ app_object_method_template = '''
   JSON {method_name}(const std::string &app_id_or_name, const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
   JSON {method_name}(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry={to_retry});
   JSON {method_name}WithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
-  JSON {method_name}WithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry={to_retry});'''
+  JSON {method_name}WithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}Async(const std::string &app_id_or_name, const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}Async(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}WithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{{}}", const bool safe_to_retry={to_retry});
+  std::future<JSON> {method_name}WithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry={to_retry});'''
 
 print preamble
 
@@ -16,6 +16,15 @@
 
 #include "SimpleHttp.h"
 #include <stdexcept>
+#include <iostream>
+#include <map>
+#include <deque>
+#include <ctime>
+#include <cerrno>
+#include <chrono>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/condition_variable.hpp>
 
 #ifndef DXTOOLKIT_GITVERSION
   #error  "Macro DXTOOLKIT_GITVERSION must be defined"
@@ -47,6 +56,27 @@ namespace dx {
       static std::string local = "dxhttp/" DXTOOLKIT_GITVERSION; // default
       return local;
     }
+
+    size_t& HTTP_POOL_MAX_IDLE() {
+      static size_t local = 16; // default (at least as many as number of threads in a typical UA run)
+      return local;
+    }
+
+    // Should be lower than curl's own limit on age of an idle connection
+    // (CURLOPT_MAXAGE_CONN, 118 seconds by default)
+    long& HTTP_POOL_IDLE_TIMEOUT() {
+      static long local = 60; // default
+      return local;
+    }
+
+    std::string& HTTP2() {
+      static std::string local = "";
+      return local;
+    }
+  }
+
+  static bool http2Enabled() {
+    return !config::HTTP2().empty() && config::HTTP2() != "0";
   }
 #if !WINDOWS_BUILD
   class SSLThreadsInitializer
@@ -91,6 +121,247 @@ namespace dx {
   int curlInitializer::init_count = 0; // definition
   curlInitializer curl_initializer_variable; // should be created just once
 
+  // Storage for HttpShare. Defined after curl_initializer_variable (and before
+  // connection_pool_state), so that it outlives all handles attached to it
+  class ShareState {
+  public:
+    struct Share {
+      CURLSH *handle;
+      // One lock per kind of data shared (see curl_share_setopt(CURLSHOPT_LOCKFUNC))
+      boost::mutex locks[CURL_LOCK_DATA_LAST];
+    };
+    Share all; // DNS, TLS sessions, and connections
+    Share sessions; // TLS sessions only (see HttpShare::TLS_SESSIONS_ONLY)
+
+    // Set while the shares exist
+    static ShareState *instance;
+
+    // Size of the shared connection cache
+    static const long MAX_CONNECTS = 256;
+
+    ShareState() {
+      all.handle = sessions.handle = NULL;
+      if (!init(all, true) || !init(sessions, false))
+        return;
+      instance = this;
+    }
+
+    ~ShareState() {
+      instance = NULL;
+      // Fails (leaking the share) if a handle still uses it, e.g., a request
+      // abandoned at exit; it's not safe to free it from under that handle
+      if (all.handle != NULL)
+        curl_share_cleanup(all.handle);
+      if (sessions.handle != NULL)
+        curl_share_cleanup(sessions.handle);
+    }
+
+    static bool init(Share &s, bool shareAll) {
+      s.handle = curl_share_init();
+      if (s.handle == NULL)
+        return false;
+      bool ok = (curl_share_setopt(s.handle, CURLSHOPT_LOCKFUNC, lock) == CURLSHE_OK) &&
+                (curl_share_setopt(s.handle, CURLSHOPT_UNLOCKFUNC, unlock) == CURLSHE_OK) &&
+                (curl_share_setopt(s.handle, CURLSHOPT_USERDATA, &s) == CURLSHE_OK) &&
+                (curl_share_setopt(s.handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION) == CURLSHE_OK) &&
+                (!shareAll || curl_share_setopt(s.handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS) == CURLSHE_OK);
+#if LIBCURL_VERSION_NUM >= 0x073900
+      // Not fatal: the pool keeps connections alive per handle anyway
+      if (ok && shareAll)
+        curl_share_setopt(s.handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+      if (!ok) {
+        curl_share_cleanup(s.handle);
+        s.handle = NULL;
+      }
+      return ok;
+    }
+
+    static void lock(CURL *, curl_lock_data data, curl_lock_access, void *userptr) {
+      static_cast<Share*>(userptr)->locks[data].lock();
+    }
+
+    static void unlock(CURL *, curl_lock_data data, void *userptr) {
+      static_cast<Share*>(userptr)->locks[data].unlock();
+    }
+  };
+  ShareState *ShareState::instance = NULL;
+  ShareState share_state;
+
+  CURLcode HttpShare::attach(CURL *curl, Scope scope) {
+    ShareState *state = ShareState::instance;
+    if (state == NULL)
+      return CURLE_OK;
+    if (scope == TLS_SESSIONS_ONLY)
+      return curl_easy_setopt(curl, CURLOPT_SHARE, state->sessions.handle);
+    CURLcode code = curl_easy_setopt(curl, CURLOPT_SHARE, state->all.handle);
+    if (code != CURLE_OK)
+      return code;
+    // The shared connection cache is trimmed to the limit of the handle using
+    // it, by default sized for a single handle rather than the whole process
+    return curl_easy_setopt(curl, CURLOPT_MAXCONNECTS, ShareState::MAX_CONNECTS);
+  }
+
+  // Storage for HttpConnectionPool. Defined after curl_initializer_variable, so
+  // that idle handles are cleaned up before curl_global_cleanup() is called.
+  class ConnectionPoolState {
+  public:
+    struct IdleHandle {
+      CURL *curl;
+      time_t since;
+      IdleHandle(CURL *curl, time_t since): curl(curl), since(since) {}
+    };
+
+    boost::mutex mtx;
+    std::map<std::string, std::deque<IdleHandle> > idle; // oldest first
+    size_t count;
+
+    // Set while the pool exists: requests made during static initialization
+    // or destruction (of other translation units) bypass the pool
+    static ConnectionPoolState *instance;
+
+    ConnectionPoolState(): count(0) {
+      instance = this;
+    }
+
+    ~ConnectionPoolState() {
+      instance = NULL;
+      std::vector<CURL*> closing;
+      removeExpired(time(NULL), closing); // i.e., all handles
+      cleanup(closing);
+    }
+
+    // Removes handles idle since before (or at) "limit" from the pool. Must be
+    // called with mtx held (or from destructor)
+    void removeExpired(time_t limit, std::vector<CURL*> &closing) {
+      std::map<std::string, std::deque<IdleHandle> >::iterator it = idle.begin();
+      while (it != idle.end()) {
+        std::deque<IdleHandle> &handles = it->second;
+        while (!handles.empty() && handles.front().since <= limit) {
+          closing.push_back(handles.front().curl);
+          handles.pop_front();
+          count--;
+        }
+        if (handles.empty())
+          idle.erase(it++);
+        else
+          ++it;
+      }
+    }
+
+    // Closing a handle can involve network I/O (e.g., TLS close notify),
+    // so it is done without holding mtx
+    static void cleanup(const std::vector<CURL*> &closing) {
+      for (unsigned i = 0; i < closing.size(); i++)
+        curl_easy_cleanup(closing[i]);
+    }
+  };
+  ConnectionPoolState *ConnectionPoolState::instance = NULL;
+  ConnectionPoolState connection_pool_state;
+
+  CURL* HttpConnectionPool::acquire(const std::string &key) {
+    ConnectionPoolState *pool = ConnectionPoolState::instance;
+    if (pool != NULL) {
+      CURL *curl = NULL;
+      std::vector<CURL*> closing;
+      {
+        boost::mutex::scoped_lock lock(pool->mtx);
+        pool->removeExpired(time(NULL) - config::HTTP_POOL_IDLE_TIMEOUT(), closing);
+        std::map<std::string, std::deque<ConnectionPoolState::IdleHandle> >::iterator it = pool->idle.find(key);
+        if (it != pool->idle.end()) {
+          // Most recently used handle is the least likely to have its connection closed by server
+          curl = it->second.back().curl;
+          it->second.pop_back();
+          pool->count--;
+          if (it->second.empty())
+            pool->idle.erase(it);
+        }
+      }
+      ConnectionPoolState::cleanup(closing);
+      if (curl != NULL)
+        return curl;
+    }
+    return curl_easy_init();
+  }
+
+  void HttpConnectionPool::release(const std::string &key, CURL *curl) {
+    ConnectionPoolState *pool = ConnectionPoolState::instance;
+    if (pool == NULL || config::HTTP_POOL_MAX_IDLE() == 0) {
+      curl_easy_cleanup(curl);
+      return;
+    }
+    // Resets all options set by the previous request (but keeps the live
+    // connection, DNS cache and TLS session ID cache of the handle)
+    curl_easy_reset(curl);
+    std::vector<CURL*> closing;
+    {
+      boost::mutex::scoped_lock lock(pool->mtx);
+      const time_t now = time(NULL);
+      pool->removeExpired(now - config::HTTP_POOL_IDLE_TIMEOUT(), closing);
+      std::deque<ConnectionPoolState::IdleHandle> &handles = pool->idle[key];
+      handles.push_back(ConnectionPoolState::IdleHandle(curl, now));
+      pool->count++;
+      while (handles.size() > config::HTTP_POOL_MAX_IDLE()) {
+        closing.push_back(handles.front().curl);
+        handles.pop_front();
+        pool->count--;
+      }
+    }
+    ConnectionPoolState::cleanup(closing);
+  }
+
+  void HttpConnectionPool::clear() {
+    ConnectionPoolState *pool = ConnectionPoolState::instance;
+    if (pool == NULL)
+      return;
+    std::vector<CURL*> closing;
+    {
+      boost::mutex::scoped_lock lock(pool->mtx);
+      pool->removeExpired(time(NULL), closing); // i.e., all handles
+    }
+    ConnectionPoolState::cleanup(closing);
+  }
+
+  size_t HttpConnectionPool::idleCount() {
+    ConnectionPoolState *pool = ConnectionPoolState::instance;
+    if (pool == NULL)
+      return 0u;
+    boost::mutex::scoped_lock lock(pool->mtx);
+    return pool->count;
+  }
+
+  std::string HttpConnectionPool::key(const std::string &url) {
+    std::string scheme = "http", rest = url; // curl assumes http if scheme is missing
+    const size_t schemeEnd = url.find("://");
+    if (schemeEnd != std::string::npos) {
+      scheme = url.substr(0, schemeEnd);
+      rest = url.substr(schemeEnd + 3);
+    }
+    std::string authority = rest.substr(0, rest.find_first_of("/?#"));
+    const size_t userinfoEnd = authority.rfind('@');
+    if (userinfoEnd != std::string::npos)
+      authority = authority.substr(userinfoEnd + 1);
+
+    // Host can be an IPv6 literal, e.g., "[::1]:8080"
+    std::string host = authority, port;
+    const size_t portStart = authority.rfind(':');
+    if (portStart != std::string::npos && authority.find(']', portStart) == std::string::npos) {
+      host = authority.substr(0, portStart);
+      port = authority.substr(portStart + 1);
+    }
+    for (unsigned i = 0; i < scheme.size(); i++)
+      scheme[i] = tolower(scheme[i]);
+    for (unsigned i = 0; i < host.size(); i++)
+      host[i] = tolower(host[i]);
+    if (port.empty()) {
+      if (scheme == "http")
+        port = "80";
+      else if (scheme == "https")
+        port = "443";
+    }
+    return scheme + "://" + host + ":" + port;
+  }
+
   /*
    * This function serves as a callback for response headers read by libcurl
    *
@@ -149,16 +420,81 @@ namespace dx {
   }
 
   /* Callback for response data */
-  static size_t write_callback(void *buffer, size_t size, size_t nmemb, void *userdata) {
+  size_t HttpRequest::bodyCallback(void *buffer, size_t size, size_t nmemb, void *userdata) {
     char *buf = reinterpret_cast<char*>(buffer);
-    std::string *response = reinterpret_cast<std::string*>(userdata);
-    size_t result = 0u;
-    if (userdata != NULL) {
-      response->append(buf, size * nmemb);
-      result = size * nmemb;
+    HttpRequest *req = reinterpret_cast<HttpRequest*>(userdata);
+    if (req == NULL)
+      return 0u;
+    // Exceptions must not propagate thru libcurl: the transfer is aborted
+    // (by returning 0), and exception is rethrown by send()
+    try {
+      if (!req->sinkStarted)
+        req->startSink();
+      if (req->sinkActive)
+        req->bodySink->write(buf, size * nmemb);
+      else
+        req->respData.append(buf, size * nmemb);
+    } catch (...) {
+      req->sinkError = std::current_exception();
+      return 0u;
+    }
+    return size * nmemb;
+  }
+
+  // Called once response headers are available (i.e., before first fragment of the body)
+  void HttpRequest::startSink() {
+    sinkStarted = true;
+    if (bodySink != NULL) {
+      curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+      sinkActive = bodySink->begin(responseCode);
+    }
+  }
+
+  bool HttpCallbackSink::begin(long responseCode) {
+    return responseCode >= 200 && responseCode < 300;
+  }
+
+  void HttpCallbackSink::write(const char *data, size_t len) {
+    callback(data, len);
+  }
+
+  bool HttpBufferSink::begin(long responseCode) {
+    size = 0;
+    return responseCode >= 200 && responseCode < 300;
+  }
+
+  void HttpBufferSink::write(const char *data, size_t len) {
+    if (len > capacity - size) {
+      std::ostringstream msg;
+      msg << "Response body is larger than the buffer provided for it (" << capacity << " bytes)";
+      throw HttpRequestException(msg.str(), HttpRequestException::BODY_SINK_OVERFLOW);
+    }
+    memcpy(buffer + size, data, len);
+    size += len;
+  }
+
+#if !WINDOWS_BUILD
+  bool HttpFileSink::begin(long responseCode) {
+    size = 0;
+    return responseCode >= 200 && responseCode < 300;
+  }
+
+  void HttpFileSink::write(const char *data, size_t len) {
+    while (len > 0) {
+      ssize_t written = pwrite(fd, data, len, offset + size);
+      if (written < 0) {
+        if (errno == EINTR)
+          continue;
+        std::ostringstream msg;
+        msg << "Unable to write response body to file (" << strerror(errno) << ")";
+        throw HttpRequestException(msg.str(), HttpRequestException::BODY_SINK_WRITE_FAILED);
+      }
+      data += written;
+      len -= written;
+      size += written;
     }
-    return result;
   }
+#endif
 
   /* Callback for reading request data (for e.g., in PUT) */
   static size_t read_callback(void *data, size_t size, size_t nmemb, void *userdata) {
@@ -214,22 +550,56 @@ namespace dx {
   //    - is negative (one of static const value defined in HttpRequestException class)
   //      if error is due to some other reason.
   void HttpRequest::send() {
-    // TODO: Not call curl_easy_cleanup() always at end of send()
-    //       Instead allow to reuse the same curl handle for subsequent requests
-    //       curl will reuse the existing connection this way - should be much faster
+    if (multiplex && http2Enabled()) {
+      sendOnEventLoop();
+      return;
+    }
+    start();
+    complete(curl_easy_perform(curl));
+  }
+
+  // Performs the request on HttpEventLoop (where it can share a connection
+  // with other requests), and waits for it to complete
+  void HttpRequest::sendOnEventLoop() {
+    struct Completion {
+      boost::mutex mtx;
+      boost::condition_variable cond;
+      bool done;
+      std::exception_ptr error;
+      Completion(): done(false) {}
+    } c;
+    HttpEventLoop::submit(*this, [&c](HttpRequest &, std::exception_ptr error) {
+      boost::mutex::scoped_lock lock(c.mtx);
+      c.error = error;
+      c.done = true;
+      c.cond.notify_all();
+    });
+    {
+      // The request refers to this object, so don't leave until it's complete
+      boost::this_thread::disable_interruption di;
+      boost::mutex::scoped_lock lock(c.mtx);
+      while (!c.done)
+        c.cond.wait(lock);
+    }
+    if (c.error)
+      std::rethrow_exception(c.error);
+  }
 
+  void HttpRequest::start() {
     // This function should never be called while "curl" member variable is in use
     if (curl != NULL)
       throw HttpRequestException("ERROR: curl member variable is already in use. Cannot be reused until previous operation is complete", HttpRequestException::ALREADY_IN_USE);
 
-    curl = curl_easy_init();
-    
-    errorBuffer[0] = 0; // since it can be the case that nothing is written to the error buffer (despite an error occured)
-    // Set errorBuffer to recieve human readable error messages from libcurl
-    // http://curl.haxx.se/libcurl/c/curl_easy_setopt.html#CURLOPTERRORBUFFER
-    assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_ERRORBUFFER, errorBuffer));
+    // Reuse an idle handle (and hence its open connection) to same server if possible
+    poolKey = HttpConnectionPool::key(url);
+    curl = HttpConnectionPool::acquire(poolKey);
 
     if (curl != NULL) {
+      errorBuffer[0] = 0; // since it can be the case that nothing is written to the error buffer (despite an error occured)
+      // Set errorBuffer to recieve human readable error messages from libcurl
+      // http://curl.haxx.se/libcurl/c/curl_easy_setopt.html#CURLOPTERRORBUFFER
+      assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_ERRORBUFFER, errorBuffer));
+
       if (config::CA_CERT() == "NOVERIFY") {
         assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0));
         assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0));
@@ -248,20 +618,32 @@ namespace dx {
       /* Set the user agent - optional */
       assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_USERAGENT, config::USER_AGENT_STRING().c_str()));
 
+      // Share DNS, TLS session (and connection) caches with all other handles
+      assertLibCurlFunctions(HttpShare::attach(curl));
+
       /* Setting this option, since libcurl fails in multi-threaded environment otherwise */
       /* See: http://curl.haxx.se/libcurl/c/libcurl-tutorial.html#Multi-threading */
       assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1l));
 
-      /* Set the header(s) */
-      curl_slist *header = NULL;
+#if LIBCURL_VERSION_NUM >= 0x072f00
+      if (http2Enabled()) {
+        // HTTP/2 is negotiated (using ALPN) for https URLs, falling back to HTTP/1.1
+        assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, (long) CURL_HTTP_VERSION_2TLS));
+        // Rather wait for a connection being set up to the same server (to
+        // multiplex over it), than open a new one in parallel
+        assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1l));
+      }
+#endif
+
+      /* Set the header(s) (list is freed once the transfer is complete) */
       std::vector<std::string> header_vec;
       header_vec = reqHeader.getAllHeadersAsVector(); // inefficient quick hack, use iterator instead
       for (unsigned i = 0;i < header_vec.size(); i++) {
-        header = curl_slist_append(header, header_vec[i].c_str());
+        headerList = curl_slist_append(headerList, header_vec[i].c_str());
       }
 
-      if (header != NULL) {
-        assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header));
+      if (headerList != NULL) {
+        assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headerList));
       }
       
       if (!config::LIBCURL_VERBOSE().empty() && config::LIBCURL_VERBOSE() != "0") {
@@ -276,7 +658,7 @@ namespace dx {
       assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_URL, url.c_str()));
 
       // Make a copy of reqData, because read_callback (see HTTP_PUT case below) will modify it
-      reqData_struct reqData_temp;
+      reqDataLeft = reqData;
 
       switch (method) {
         case HTTP_POST:
@@ -288,7 +670,6 @@ namespace dx {
           assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, reqData.length));
           break;
         case HTTP_PUT:
-          reqData_temp = reqData; // Make a copy, since it will be modified
           // Set the request type to PUT
           // Using two methods to do it just to be safe
           // NOTE: CURLOPT_PUT will be deprecated in future libcurl)
@@ -299,7 +680,7 @@ namespace dx {
            // Now set the read_call back function.
             assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_READFUNCTION, read_callback));
             /** set data object to pass to callback function */
-            assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_READDATA, &reqData_temp));
+            assertLibCurlFunctions(curl_easy_setopt(curl, CURLOPT_READDATA, &reqDataLeft));
           }
           break;
         case HTTP_GET:
@@ -322,21 +703,231 @@ namespace dx {
 
       // Set callback for recieving the response data
       /** set callback function */
-      assertLibCurlFunctions( curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback) );
-      /** "respData" is a member variable of HttpRequest */
-      assertLibCurlFunctions( curl_easy_setopt(curl, CURLOPT_WRITEDATA, &respData) );
-      
-      /* Perform the actual request */
-      assertLibCurlFunctions( curl_easy_perform(curl), "Error in using curl_easy_perform.");
-      
+      assertLibCurlFunctions( curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, bodyCallback) );
+      /** Body is stored in "respData" (a member variable of HttpRequest), or passed to "bodySink" */
+      assertLibCurlFunctions( curl_easy_setopt(curl, CURLOPT_WRITEDATA, this) );
+      sinkStarted = sinkActive = false;
+      sinkError = std::exception_ptr();
+    } else {
+      throw HttpRequestException("Error: Unable to initialize object of type CURL", HttpRequestException::INIT_FAILED);
+    }
+  }
+
+  void HttpRequest::complete(CURLcode result) {
+    // Request headers are no longer needed
+    curl_slist_free_all(headerList);
+    headerList = NULL;
+    try {
+      if (sinkError) {
+        // The body sink threw an exception (and transfer was aborted)
+        std::rethrow_exception(sinkError);
+      }
+      assertLibCurlFunctions(result, "Error in using curl_easy_perform.");
+
       assertLibCurlFunctions( curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode) );
 
-      /* always cleanup */
+      // Sink is notified even if the response had no body
+      if (!sinkStarted)
+        startSink();
+    } catch (...) {
+      // State of the connection is unknown: do not return the handle to pool
+      discardHandle();
+      throw;
+    }
+
+    // Keep the handle (and its connection) for subsequent requests
+    HttpConnectionPool::release(poolKey, curl);
+    curl = NULL;
+  }
+
+  void HttpRequest::discardHandle() {
+    if (curl != NULL) {
       curl_easy_cleanup(curl);
-      
       curl = NULL;
-    } else {
-      throw HttpRequestException("Error: Unable to initialize object of type CURL", HttpRequestException::INIT_FAILED);
     }
+    if (headerList != NULL) {
+      curl_slist_free_all(headerList);
+      headerList = NULL;
+    }
+  }
+
+  // State of HttpEventLoop. Defined after connection_pool_state (so that the
+  // event loop thread is stopped before the pool is destroyed).
+  class EventLoopState {
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Transfer {
+      HttpRequest *req;
+      HttpEventLoop::Callback done;
+      Transfer(): req(NULL) {}
+      Transfer(HttpRequest *req, const HttpEventLoop::Callback &done): req(req), done(done) {}
+    };
+
+    // Shared with submit() (guarded by mtx)
+    boost::mutex mtx;
+    std::multimap<Clock::time_point, Transfer> pending; // by time they should be started at
+    bool stopping;
+
+    // Only used by the event loop thread (once started)
+    CURLM *multi;
+    boost::thread *thread;
+    std::map<CURL*, Transfer> running;
+
+    // Set while the event loop can be used (see ConnectionPoolState::instance)
+    static EventLoopState *instance;
+
+    EventLoopState(): stopping(false), multi(NULL), thread(NULL) {
+      instance = this;
+    }
+
+    ~EventLoopState() {
+      instance = NULL;
+      if (thread != NULL) {
+        {
+          boost::mutex::scoped_lock lock(mtx);
+          stopping = true;
+        }
+        wakeup();
+        thread->join();
+        delete thread;
+      }
+      // Unfinished requests fail, so that whoever waits for them is notified
+      const std::exception_ptr stopped = std::make_exception_ptr(
+          HttpRequestException("Error: HttpEventLoop was stopped before the request completed", HttpRequestException::EVENT_LOOP_STOPPED));
+      for (std::map<CURL*, Transfer>::iterator it = running.begin(); it != running.end(); ++it) {
+        curl_multi_remove_handle(multi, it->first);
+        it->second.req->discardHandle();
+        finish(it->second, stopped);
+      }
+      running.clear();
+      std::multimap<Clock::time_point, Transfer> notStarted;
+      {
+        boost::mutex::scoped_lock lock(mtx);
+        notStarted.swap(pending);
+      }
+      for (std::multimap<Clock::time_point, Transfer>::iterator it = notStarted.begin(); it != notStarted.end(); ++it)
+        finish(it->second, stopped);
+      if (multi != NULL)
+        curl_multi_cleanup(multi);
+    }
+
+    // Interrupts the wait for network activity in run()
+    void wakeup() {
+#if LIBCURL_VERSION_NUM >= 0x074400
+      curl_multi_wakeup(multi);
+#endif
+    }
+
+    void run() {
+      // Without curl_multi_wakeup(), newly submitted requests are only noticed periodically
+#if LIBCURL_VERSION_NUM >= 0x074400
+      const long MAX_WAIT_MS = 1000;
+#else
+      const long MAX_WAIT_MS = 50;
+#endif
+      while (true) {
+        std::vector<Transfer> starting;
+        long waitMs = MAX_WAIT_MS;
+        {
+          boost::mutex::scoped_lock lock(mtx);
+          if (stopping)
+            return;
+          const Clock::time_point now = Clock::now();
+          while (!pending.empty() && pending.begin()->first <= now) {
+            starting.push_back(pending.begin()->second);
+            pending.erase(pending.begin());
+          }
+          if (!pending.empty()) {
+            const long untilNext = std::chrono::duration_cast<std::chrono::milliseconds>(pending.begin()->first - now).count() + 1;
+            waitMs = std::min(waitMs, untilNext);
+          }
+        }
+
+        for (unsigned i = 0; i < starting.size(); i++) {
+          HttpRequest &req = *starting[i].req;
+          try {
+            req.start();
+            CURLMcode code = curl_multi_add_handle(multi, req.curl);
+            if (code != CURLM_OK) {
+              req.discardHandle();
+              throw HttpRequestException(std::string("Unable to add request to the event loop: ") + curl_multi_strerror(code), HttpRequestException::INIT_FAILED);
+            }
+            running[req.curl] = starting[i];
+          } catch (...) {
+            finish(starting[i], std::current_exception());
+          }
+        }
+
+        int stillRunning;
+        curl_multi_perform(multi, &stillRunning);
+
+        CURLMsg *msg;
+        int msgsLeft;
+        while ((msg = curl_multi_info_read(multi, &msgsLeft)) != NULL) {
+          if (msg->msg != CURLMSG_DONE)
+            continue;
+          // Note: "msg" is invalidated by curl_multi_remove_handle()
+          CURL *curl = msg->easy_handle;
+          const CURLcode result = msg->data.result;
+          curl_multi_remove_handle(multi, curl);
+          std::map<CURL*, Transfer>::iterator it = running.find(curl);
+          Transfer t = it->second;
+          running.erase(it);
+          std::exception_ptr error;
+          try {
+            t.req->complete(result);
+          } catch (...) {
+            error = std::current_exception();
+          }
+          finish(t, error);
+        }
+
+        long curlTimeout = -1;
+        curl_multi_timeout(multi, &curlTimeout);
+        if (curlTimeout >= 0)
+          waitMs = std::min(waitMs, curlTimeout);
+#if LIBCURL_VERSION_NUM >= 0x074400
+        curl_multi_poll(multi, NULL, 0, waitMs, NULL);
+#else
+        curl_multi_wait(multi, NULL, 0, waitMs, NULL);
+#endif
+      }
+    }
+
+    // Exceptions thrown by the callback have no one to be reported to (other than the log)
+    static void finish(const Transfer &t, std::exception_ptr error) {
+      try {
+        t.done(*t.req, error);
+      } catch (std::exception &e) {
+        std::cerr << "SimpleHttp: Exception thrown by a completion callback of HttpEventLoop was ignored: " << e.what() << std::endl;
+      } catch (...) {
+        std::cerr << "SimpleHttp: Exception thrown by a completion callback of HttpEventLoop was ignored" << std::endl;
+      }
+    }
+  };
+  EventLoopState *EventLoopState::instance = NULL;
+  EventLoopState event_loop_state;
+
+  void HttpEventLoop::submit(HttpRequest &req, const Callback &done, unsigned delaySeconds) {
+    EventLoopState *loop = EventLoopState::instance;
+    if (loop == NULL)
+      throw HttpRequestException("Error: HttpEventLoop is not available", HttpRequestException::INIT_FAILED);
+    {
+      boost::mutex::scoped_lock lock(loop->mtx);
+      if (loop->thread == NULL) {
+        loop->multi = curl_multi_init();
+        if (loop->multi == NULL)
+          throw HttpRequestException("Error: Unable to initialize object of type CURLM", HttpRequestException::INIT_FAILED);
+#if LIBCURL_VERSION_NUM >= 0x072b00
+        // Concurrent requests to an HTTP/2 server share a connection
+        curl_multi_setopt(loop->multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+        loop->thread = new boost::thread(&EventLoopState::run, loop);
+      }
+      const EventLoopState::Clock::time_point startAt = EventLoopState::Clock::now() + std::chrono::seconds(delaySeconds);
+      loop->pending.insert(std::make_pair(startAt, EventLoopState::Transfer(&req, done)));
+    }
+    loop->wakeup();
   }
 }
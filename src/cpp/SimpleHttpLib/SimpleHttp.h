@@ -25,6 +25,7 @@
 #include <cstring>
 #include <curl/curl.h>
 #include <exception>
+#include <functional>
 #include <cassert>
 #include <sstream>
 #include <unistd.h>
@@ -37,6 +38,18 @@ namespace dx {
     std::string& CA_CERT();
     std::string& USER_AGENT_STRING();
     std::string& LIBCURL_VERBOSE();
+
+    // Limits of HttpConnectionPool: maximum number of idle curl handles kept
+    // per server (0 disables pooling), and number of seconds after which an
+    // idle handle is closed instead of being reused. dxcpp reads them from
+    // DX_HTTP_POOL_MAX_IDLE and DX_HTTP_POOL_IDLE_TIMEOUT (see loadFromEnvironment())
+    size_t& HTTP_POOL_MAX_IDLE();
+    long& HTTP_POOL_IDLE_TIMEOUT();
+
+    // If set (to anything other than "0"), HTTP/2 is negotiated with servers
+    // which support it, and requests with HttpRequest::multiplex set share
+    // connections (see HttpRequest::send())
+    std::string& HTTP2();
   }
 
   enum HttpMethod {
@@ -59,11 +72,157 @@ namespace dx {
     return "UNKNOWN_HTTP_METHOD";
   }
 
+  /** Receives the response body of an HttpRequest as it arrives from network
+    * (see HttpRequest::bodySink), instead of it being accumulated in
+    * HttpRequest::respData.
+    */
+  class HttpBodySink {
+  public:
+    virtual ~HttpBodySink() {}
+
+    /** Called once per request, after the response headers have been received
+      * (and before any call to write()).
+      * @param responseCode HTTP response code
+      * @return true if the body should be passed to write(), false if it should be
+      *         stored in HttpRequest::respData as usual (e.g., for error responses)
+      */
+    virtual bool begin(long responseCode) = 0;
+
+    /** Called for each fragment of the response body (only if begin() returned true).
+      * An exception thrown from here aborts the transfer, and is rethrown by HttpRequest::send().
+      */
+    virtual void write(const char *data, size_t len) = 0;
+  };
+
+  /** Passes each fragment of a successful (2xx) response body to a callback */
+  class HttpCallbackSink: public HttpBodySink {
+  public:
+    typedef std::function<void (const char *data, size_t len)> Callback;
+    Callback callback;
+
+    explicit HttpCallbackSink(const Callback &callback): callback(callback) {}
+    bool begin(long responseCode);
+    void write(const char *data, size_t len);
+  };
+
+  /** Stores a successful (2xx) response body directly in a caller-owned buffer
+    * of known capacity (e.g., sized from the Range requested). A body larger
+    * than the buffer aborts the request (with an HttpRequestException).
+    */
+  class HttpBufferSink: public HttpBodySink {
+  public:
+    char *buffer; // Not owned by the sink
+    size_t capacity;
+    size_t size; // Number of bytes received (reset by begin(), i.e., on every attempt)
+
+    HttpBufferSink(char *buffer, size_t capacity): buffer(buffer), capacity(capacity), size(0) {}
+    bool begin(long responseCode);
+    void write(const char *data, size_t len);
+  };
+
+#if !WINDOWS_BUILD
+  /** Writes a successful (2xx) response body to a file descriptor, starting at
+    * given offset. Uses pwrite(), so that concurrent requests can fill distinct
+    * regions of the same file. A failed write aborts the request (with an
+    * HttpRequestException).
+    */
+  class HttpFileSink: public HttpBodySink {
+  public:
+    int fd; // Not owned (closed) by the sink
+    off_t offset;
+    off_t size; // Number of bytes written (reset by begin(), i.e., on every attempt)
+
+    HttpFileSink(int fd, off_t offset = 0): fd(fd), offset(offset), size(0) {}
+    bool begin(long responseCode);
+    void write(const char *data, size_t len);
+  };
+#endif
+
+  /** Process-wide curl share handle, through which curl handles share a DNS
+    * cache, a TLS session cache and (with libcurl >= 7.57) a connection cache,
+    * so that a host is resolved, and a TLS session negotiated, once per
+    * process rather than once per handle. HttpRequest uses it for every
+    * request; code performing its own transfers opts in using attach().
+    */
+  class HttpShare {
+  public:
+    enum Scope {
+      ALL, // DNS, TLS session and connection caches
+      TLS_SESSIONS_ONLY // For handles which must not share DNS entries or connections, e.g., ones using CURLOPT_RESOLVE
+    };
+
+    /** Makes "curl" use the shared caches (with scope ALL, also raising its
+      * CURLOPT_MAXCONNECTS, which bounds the shared connection cache). Must be
+      * called again after curl_easy_reset(). Does nothing (and returns
+      * CURLE_OK) if the share is not available (i.e., during static
+      * initialization or destruction).
+      * @note With scope ALL, CURLOPT_RESOLVE entries of the handle are added
+      * to the shared DNS cache (and so used by all the other handles), and
+      * connections to the resolved host are reused regardless of the address
+      * the handle asked for.
+      */
+    static CURLcode attach(CURL *curl, Scope scope = ALL);
+  };
+
+  /** Process-wide pool of idle curl easy handles, used by HttpRequest::send().
+    * A curl handle keeps the connection it opened alive once a transfer is
+    * complete, so reusing it for the next request to the same server saves
+    * a TCP connect and TLS handshake. Handles are keyed by scheme, host and
+    * port (see key()), and bounded by config::HTTP_POOL_MAX_IDLE() and
+    * config::HTTP_POOL_IDLE_TIMEOUT(). All functions are thread-safe (a
+    * handle is only ever used by the thread which acquired it).
+    */
+  class HttpConnectionPool {
+  public:
+    /** Returns an idle handle for the given key if there is one (most
+      * recently used first), else a new handle (NULL if curl_easy_init() fails).
+      */
+    static CURL* acquire(const std::string &key);
+
+    /** Returns a handle (after a successful transfer) to the pool, with all
+      * its options reset. The handle is closed instead if the pool is full.
+      */
+    static void release(const std::string &key, CURL *curl);
+
+    /** Closes all idle handles (and hence their connections) */
+    static void clear();
+
+    /** Number of idle handles currently in the pool */
+    static size_t idleCount();
+
+    /** Returns the pool key for a URL: "scheme://host:port", in lower case,
+      * and with the default port filled in for http and https.
+      */
+    static std::string key(const std::string &url);
+  };
+
   class HttpRequest {
   private:
 
     CURL *curl;
 
+    // State of the transfer in progress (see start() and complete())
+    std::string poolKey;
+    curl_slist *headerList;
+
+    // State of the body sink for current request
+    bool sinkStarted, sinkActive;
+    std::exception_ptr sinkError;
+
+    static size_t bodyCallback(void *buffer, size_t size, size_t nmemb, void *userdata);
+    void startSink();
+
+    // A request is made in two steps (so that it can either be performed by
+    // send(), or by HttpEventLoop): start() sets up "curl" handle, and
+    // complete() processes result of the transfer, and releases the handle.
+    // Both throw HttpRequestException (as send() does).
+    void start();
+    void complete(CURLcode result);
+    void discardHandle();
+    void sendOnEventLoop();
+
+    friend class EventLoopState; // HttpEventLoop's implementation
+
   public:
 
     HttpHeaders reqHeader, respHeader;
@@ -92,8 +251,18 @@ namespace dx {
     // implementation store it as contiguous storage, so no performance loss there.
     std::string respData;
 
+    // If set, the response body is passed to this sink (as it arrives), instead of
+    // being stored in respData (see HttpBodySink::begin()). Not owned by HttpRequest.
+    HttpBodySink *bodySink;
+
+    // If set (and HTTP/2 mode is on, see config::HTTP2()), send() performs the
+    // request on HttpEventLoop's multi handle: all such requests (from any
+    // thread) to a server supporting HTTP/2 are then multiplexed over a few
+    // connections. Best suited for small requests (e.g., API calls).
+    bool multiplex;
+
     HttpRequest()
-      : curl(NULL), method(HTTP_POST), responseCode(-1) {
+      : curl(NULL), headerList(NULL), sinkStarted(false), sinkActive(false), method(HTTP_POST), responseCode(-1), bodySink(NULL), multiplex(false) {
         memset(errorBuffer, 0, CURL_ERROR_SIZE + 1); // Reset error buffer to zero
     }
 
@@ -130,28 +299,57 @@ namespace dx {
       respHeader.clear(); reqHeader.clear();
       reqData.data = NULL; reqData.length = 0u;
       respData = "";
+      bodySink = NULL;
+      multiplex = false;
       responseCode = -1;
-      curl = NULL;
+      discardHandle();
       method = HTTP_POST;
       url = "";
     }
 
     ~HttpRequest() {
-      if (curl != NULL) {
-        curl_easy_cleanup(curl);
-      }
+      discardHandle();
     }
     
     void assertLibCurlFunctions(CURLcode retVal, const std::string &msg);
     
     static HttpRequest request(const HttpMethod& _method, const std::string& _url,
-                               const HttpHeaders& _reqHeader = HttpHeaders(), const char* _data = NULL, const size_t& _length = 0u) {
+                               const HttpHeaders& _reqHeader = HttpHeaders(), const char* _data = NULL, const size_t& _length = 0u,
+                               HttpBodySink *_bodySink = NULL) {
       HttpRequest hr;
       hr.buildRequest(_method, _url, _reqHeader, _data, _length);
+      hr.bodySink = _bodySink;
       hr.send();
       return hr;
     }
 
+  private:
+    reqData_struct reqDataLeft; // Part of reqData not yet sent (for HTTP_PUT)
+  };
+
+  /** Performs HttpRequests concurrently on a single background thread, using
+    * curl's multi interface: any number of requests can be in flight without
+    * a thread (or blocking call) for each of them. The thread is started when
+    * first request is submitted, and stopped at exit: requests still in
+    * flight (or waiting to be started) then complete with an
+    * HttpRequestException (with errorCode EVENT_LOOP_STOPPED).
+    */
+  class HttpEventLoop {
+  public:
+    /** Called on the event loop thread once a submitted request is complete.
+      * "error" is set to the exception HttpRequest::send() would have thrown
+      * (if any). Must not block, but can submit further requests (including
+      * the same one again).
+      */
+    typedef std::function<void (HttpRequest &req, std::exception_ptr error)> Callback;
+
+    /** Starts the request "req" (after "delaySeconds", if non-zero), and
+      * calls "done" once it's complete. "req" must not be modified or
+      * destroyed until then. Can be called from any thread.
+      * Throws HttpRequestException (with errorCode INIT_FAILED) if the event
+      * loop can't be started.
+      */
+    static void submit(HttpRequest &req, const Callback &done, unsigned delaySeconds = 0u);
   };
 
   class HttpRequestException : public std::exception {
@@ -160,6 +358,9 @@ namespace dx {
       UNSUPPORTED_HTTP_METHOD = -1,
       INIT_FAILED = -2,
       ALREADY_IN_USE = -3,
+      BODY_SINK_OVERFLOW = -4,
+      BODY_SINK_WRITE_FAILED = -5,
+      EVENT_LOOP_STOPPED = -6,
       DEFAULT_VALUE = -100 // Used just for default constructor (never actually set by any function)
     };
     std::string err;
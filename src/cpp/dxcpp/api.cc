@@ -14,6 +14,14 @@ namespace dx {
     return analysisAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> analysisAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> analysisAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return analysisAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON analysisDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -22,6 +30,14 @@ namespace dx {
     return analysisDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> analysisDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> analysisDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return analysisDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON analysisRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -30,6 +46,14 @@ namespace dx {
     return analysisRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> analysisRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> analysisRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return analysisRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON analysisSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -38,6 +62,14 @@ namespace dx {
     return analysisSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> analysisSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> analysisSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return analysisSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON analysisTerminate(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/terminate"), input_params, safe_to_retry);
   }
@@ -46,6 +78,14 @@ namespace dx {
     return analysisTerminate(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> analysisTerminateAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/terminate"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> analysisTerminateAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return analysisTerminateAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appAddAuthorizedUsers(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/addAuthorizedUsers"), input_params, safe_to_retry);
   }
@@ -62,6 +102,22 @@ namespace dx {
     return appAddAuthorizedUsersWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appAddAuthorizedUsersAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/addAuthorizedUsers"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddAuthorizedUsersAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appAddAuthorizedUsersAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appAddAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appAddAuthorizedUsersAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appAddAuthorizedUsersWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appAddCategories(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/addCategories"), input_params, safe_to_retry);
   }
@@ -78,6 +134,22 @@ namespace dx {
     return appAddCategoriesWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appAddCategoriesAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/addCategories"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddCategoriesAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appAddCategoriesAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appAddCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appAddCategoriesAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appAddCategoriesWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appAddDevelopers(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/addDevelopers"), input_params, safe_to_retry);
   }
@@ -94,6 +166,22 @@ namespace dx {
     return appAddDevelopersWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appAddDevelopersAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/addDevelopers"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddDevelopersAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appAddDevelopersAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appAddDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appAddDevelopersAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appAddDevelopersWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appAddTags(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -110,6 +198,22 @@ namespace dx {
     return appAddTagsWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appAddTagsAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddTagsAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appAddTagsAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appAddTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appAddTagsAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appAddTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appAddTagsWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appDelete(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/delete"), input_params, safe_to_retry);
   }
@@ -126,6 +230,22 @@ namespace dx {
     return appDeleteWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appDeleteAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/delete"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appDeleteAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appDeleteAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appDeleteWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appDeleteAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appDeleteWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appDeleteWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appDescribe(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -142,6 +262,22 @@ namespace dx {
     return appDescribeWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appDescribeAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appDescribeAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appDescribeAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appDescribeWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appDescribeAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appDescribeWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appDescribeWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appGet(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/get"), input_params, safe_to_retry);
   }
@@ -158,6 +294,22 @@ namespace dx {
     return appGetWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appGetAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/get"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appGetAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appGetAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appGetWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appGetAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appGetWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appGetWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appInstall(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/install"), input_params, safe_to_retry);
   }
@@ -174,6 +326,22 @@ namespace dx {
     return appInstallWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appInstallAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/install"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appInstallAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appInstallAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appInstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appInstallAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appInstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appInstallWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appListAuthorizedUsers(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/listAuthorizedUsers"), input_params, safe_to_retry);
   }
@@ -190,6 +358,22 @@ namespace dx {
     return appListAuthorizedUsersWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appListAuthorizedUsersAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/listAuthorizedUsers"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appListAuthorizedUsersAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appListAuthorizedUsersAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appListAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appListAuthorizedUsersAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appListAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appListAuthorizedUsersWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appListCategories(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/listCategories"), input_params, safe_to_retry);
   }
@@ -206,6 +390,22 @@ namespace dx {
     return appListCategoriesWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appListCategoriesAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/listCategories"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appListCategoriesAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appListCategoriesAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appListCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appListCategoriesAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appListCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appListCategoriesWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appListDevelopers(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/listDevelopers"), input_params, safe_to_retry);
   }
@@ -222,6 +422,22 @@ namespace dx {
     return appListDevelopersWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appListDevelopersAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/listDevelopers"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appListDevelopersAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appListDevelopersAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appListDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appListDevelopersAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appListDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appListDevelopersWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appPublish(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/publish"), input_params, safe_to_retry);
   }
@@ -238,6 +454,22 @@ namespace dx {
     return appPublishWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appPublishAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/publish"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appPublishAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appPublishAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appPublishWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appPublishAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appPublishWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appPublishWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appRemoveAuthorizedUsers(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/removeAuthorizedUsers"), input_params, safe_to_retry);
   }
@@ -254,6 +486,22 @@ namespace dx {
     return appRemoveAuthorizedUsersWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appRemoveAuthorizedUsersAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/removeAuthorizedUsers"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveAuthorizedUsersAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveAuthorizedUsersAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appRemoveAuthorizedUsersAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveAuthorizedUsersWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appRemoveCategories(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/removeCategories"), input_params, safe_to_retry);
   }
@@ -270,6 +518,22 @@ namespace dx {
     return appRemoveCategoriesWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appRemoveCategoriesAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/removeCategories"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveCategoriesAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveCategoriesAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appRemoveCategoriesAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveCategoriesWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appRemoveDevelopers(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/removeDevelopers"), input_params, safe_to_retry);
   }
@@ -286,6 +550,22 @@ namespace dx {
     return appRemoveDevelopersWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appRemoveDevelopersAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/removeDevelopers"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveDevelopersAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveDevelopersAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appRemoveDevelopersAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveDevelopersWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appRemoveTags(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -302,6 +582,22 @@ namespace dx {
     return appRemoveTagsWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appRemoveTagsAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveTagsAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveTagsAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appRemoveTagsAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRemoveTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appRemoveTagsWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appRun(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/run"), input_params, safe_to_retry);
   }
@@ -320,6 +616,24 @@ namespace dx {
     return appRunWithAlias(app_name, app_alias, input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appRunAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/run"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRunAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return appRunAsync(app_id_or_name, input_params_cp.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appRunWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appRunAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appRunWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return appRunWithAliasAsync(app_name, app_alias, input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON appUninstall(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/uninstall"), input_params, safe_to_retry);
   }
@@ -336,6 +650,22 @@ namespace dx {
     return appUninstallWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appUninstallAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/uninstall"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appUninstallAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appUninstallAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appUninstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appUninstallAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appUninstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appUninstallWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appUpdate(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + app_id_or_name + std::string("/update"), input_params, safe_to_retry);
   }
@@ -352,6 +682,22 @@ namespace dx {
     return appUpdateWithAlias(app_name, app_alias, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appUpdateAsync(const std::string &app_id_or_name, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + app_id_or_name + std::string("/update"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appUpdateAsync(const std::string &app_id_or_name, const JSON &input_params, const bool safe_to_retry) {
+    return appUpdateAsync(app_id_or_name, input_params.toString(), safe_to_retry);
+  }
+
+  std::future<JSON> appUpdateWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params, const bool safe_to_retry) {
+    return appUpdateAsync(app_name + std::string("/") + app_alias, input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appUpdateWithAliasAsync(const std::string &app_name, const std::string &app_alias, const JSON &input_params, const bool safe_to_retry) {
+    return appUpdateWithAliasAsync(app_name, app_alias, input_params.toString(), safe_to_retry);
+  }
+
   JSON appNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/app/new", input_params, safe_to_retry);
   }
@@ -361,6 +707,15 @@ namespace dx {
     return appNew(input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/app/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return appNewAsync(input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON appletAddTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -369,6 +724,14 @@ namespace dx {
     return appletAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -377,6 +740,14 @@ namespace dx {
     return appletDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletGet(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/get"), input_params, safe_to_retry);
   }
@@ -385,6 +756,14 @@ namespace dx {
     return appletGet(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletGetAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/get"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletGetAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletGetAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletGetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
   }
@@ -393,6 +772,14 @@ namespace dx {
     return appletGetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletGetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletGetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletGetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletListProjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
   }
@@ -401,6 +788,14 @@ namespace dx {
     return appletListProjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletListProjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletListProjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletListProjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -409,6 +804,14 @@ namespace dx {
     return appletRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletRename(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
   }
@@ -417,6 +820,14 @@ namespace dx {
     return appletRename(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletRenameAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletRenameAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletRenameAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletRun(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/run"), input_params, safe_to_retry);
   }
@@ -426,6 +837,15 @@ namespace dx {
     return appletRun(object_id, input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletRunAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/run"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletRunAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return appletRunAsync(object_id, input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON appletSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -434,6 +854,14 @@ namespace dx {
     return appletSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return appletSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON appletNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/applet/new", input_params, safe_to_retry);
   }
@@ -443,6 +871,15 @@ namespace dx {
     return appletNew(input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> appletNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/applet/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> appletNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return appletNewAsync(input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON containerClone(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/clone"), input_params, safe_to_retry);
   }
@@ -451,6 +888,14 @@ namespace dx {
     return containerClone(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerCloneAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/clone"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerCloneAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerCloneAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -459,6 +904,14 @@ namespace dx {
     return containerDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerDestroy(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/destroy"), input_params, safe_to_retry);
   }
@@ -467,6 +920,14 @@ namespace dx {
     return containerDestroy(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerDestroyAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/destroy"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerDestroyAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerDestroyAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerListFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/listFolder"), input_params, safe_to_retry);
   }
@@ -475,6 +936,14 @@ namespace dx {
     return containerListFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerListFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/listFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerListFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerListFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerMove(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/move"), input_params, safe_to_retry);
   }
@@ -483,6 +952,14 @@ namespace dx {
     return containerMove(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerMoveAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/move"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerMoveAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerMoveAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerNewFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/newFolder"), input_params, safe_to_retry);
   }
@@ -491,6 +968,14 @@ namespace dx {
     return containerNewFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerNewFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/newFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerNewFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerNewFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerRemoveFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeFolder"), input_params, safe_to_retry);
   }
@@ -499,6 +984,14 @@ namespace dx {
     return containerRemoveFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerRemoveFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerRemoveFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerRemoveFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerRemoveObjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeObjects"), input_params, safe_to_retry);
   }
@@ -507,6 +1000,14 @@ namespace dx {
     return containerRemoveObjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerRemoveObjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeObjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerRemoveObjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerRemoveObjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON containerRenameFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/renameFolder"), input_params, safe_to_retry);
   }
@@ -515,6 +1016,14 @@ namespace dx {
     return containerRenameFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> containerRenameFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/renameFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> containerRenameFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return containerRenameFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileAddTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -523,6 +1032,14 @@ namespace dx {
     return fileAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileAddTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
   }
@@ -531,6 +1048,14 @@ namespace dx {
     return fileAddTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileAddTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileAddTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileAddTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileClose(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
   }
@@ -539,6 +1064,14 @@ namespace dx {
     return fileClose(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileCloseAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileCloseAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileCloseAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -547,6 +1080,14 @@ namespace dx {
     return fileDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileDownload(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/download"), input_params, safe_to_retry);
   }
@@ -555,6 +1096,14 @@ namespace dx {
     return fileDownload(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileDownloadAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/download"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileDownloadAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileDownloadAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileGetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
   }
@@ -563,6 +1112,14 @@ namespace dx {
     return fileGetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileGetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileGetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileGetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileListProjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
   }
@@ -571,6 +1128,14 @@ namespace dx {
     return fileListProjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileListProjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileListProjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileListProjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -579,6 +1144,14 @@ namespace dx {
     return fileRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileRemoveTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
   }
@@ -587,6 +1160,14 @@ namespace dx {
     return fileRemoveTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileRemoveTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileRemoveTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileRemoveTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileRename(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
   }
@@ -595,6 +1176,14 @@ namespace dx {
     return fileRename(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileRenameAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileRenameAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileRenameAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileSetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
   }
@@ -603,6 +1192,14 @@ namespace dx {
     return fileSetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileSetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileSetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileSetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -611,6 +1208,14 @@ namespace dx {
     return fileSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileSetVisibility(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
   }
@@ -619,6 +1224,14 @@ namespace dx {
     return fileSetVisibility(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileSetVisibilityAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileSetVisibilityAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileSetVisibilityAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileUpload(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/upload"), input_params, safe_to_retry);
   }
@@ -627,6 +1240,14 @@ namespace dx {
     return fileUpload(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileUploadAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/upload"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileUploadAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return fileUploadAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON fileNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/file/new", input_params, safe_to_retry);
   }
@@ -636,6 +1257,15 @@ namespace dx {
     return fileNew(input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> fileNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/file/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> fileNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return fileNewAsync(input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON gtableAddRows(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addRows"), input_params, safe_to_retry);
   }
@@ -644,6 +1274,14 @@ namespace dx {
     return gtableAddRows(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableAddRowsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addRows"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableAddRowsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableAddRowsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableAddTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -652,6 +1290,14 @@ namespace dx {
     return gtableAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableAddTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
   }
@@ -660,6 +1306,14 @@ namespace dx {
     return gtableAddTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableAddTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableAddTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableAddTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableClose(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
   }
@@ -668,6 +1322,14 @@ namespace dx {
     return gtableClose(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableCloseAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableCloseAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableCloseAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -676,6 +1338,14 @@ namespace dx {
     return gtableDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableGet(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/get"), input_params, safe_to_retry);
   }
@@ -684,6 +1354,14 @@ namespace dx {
     return gtableGet(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableGetAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/get"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableGetAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableGetAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableGetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
   }
@@ -692,6 +1370,14 @@ namespace dx {
     return gtableGetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableGetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableGetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableGetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableListProjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
   }
@@ -700,6 +1386,14 @@ namespace dx {
     return gtableListProjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableListProjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableListProjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableListProjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableNextPart(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/nextPart"), input_params, safe_to_retry);
   }
@@ -708,6 +1402,14 @@ namespace dx {
     return gtableNextPart(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableNextPartAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/nextPart"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableNextPartAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableNextPartAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -716,6 +1418,14 @@ namespace dx {
     return gtableRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableRemoveTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
   }
@@ -724,6 +1434,14 @@ namespace dx {
     return gtableRemoveTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableRemoveTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableRemoveTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableRemoveTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableRename(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
   }
@@ -732,6 +1450,14 @@ namespace dx {
     return gtableRename(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableRenameAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableRenameAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableRenameAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableSetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
   }
@@ -740,6 +1466,14 @@ namespace dx {
     return gtableSetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableSetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableSetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableSetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -748,6 +1482,14 @@ namespace dx {
     return gtableSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableSetVisibility(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
   }
@@ -756,6 +1498,14 @@ namespace dx {
     return gtableSetVisibility(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableSetVisibilityAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableSetVisibilityAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return gtableSetVisibilityAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON gtableNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/gtable/new", input_params, safe_to_retry);
   }
@@ -764,6 +1514,14 @@ namespace dx {
     return gtableNew(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> gtableNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/gtable/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> gtableNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    return gtableNewAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON jobAddTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -772,6 +1530,14 @@ namespace dx {
     return jobAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> jobAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> jobAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return jobAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON jobDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -780,6 +1546,14 @@ namespace dx {
     return jobDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> jobDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> jobDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return jobDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON jobGetLog(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/getLog"), input_params, safe_to_retry);
   }
@@ -788,6 +1562,14 @@ namespace dx {
     return jobGetLog(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> jobGetLogAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/getLog"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> jobGetLogAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return jobGetLogAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON jobRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -796,6 +1578,14 @@ namespace dx {
     return jobRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> jobRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> jobRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return jobRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON jobSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -804,6 +1594,14 @@ namespace dx {
     return jobSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> jobSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> jobSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return jobSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON jobTerminate(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/terminate"), input_params, safe_to_retry);
   }
@@ -812,6 +1610,14 @@ namespace dx {
     return jobTerminate(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> jobTerminateAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/terminate"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> jobTerminateAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return jobTerminateAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON jobNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/job/new", input_params, safe_to_retry);
   }
@@ -821,6 +1627,15 @@ namespace dx {
     return jobNew(input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> jobNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/job/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> jobNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return jobNewAsync(input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON notificationsGet(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/notifications/get", input_params, safe_to_retry);
   }
@@ -829,6 +1644,14 @@ namespace dx {
     return notificationsGet(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> notificationsGetAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/notifications/get", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> notificationsGetAsync(const JSON &input_params, const bool safe_to_retry) {
+    return notificationsGetAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON notificationsMarkRead(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/notifications/markRead", input_params, safe_to_retry);
   }
@@ -837,6 +1660,14 @@ namespace dx {
     return notificationsMarkRead(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> notificationsMarkReadAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/notifications/markRead", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> notificationsMarkReadAsync(const JSON &input_params, const bool safe_to_retry) {
+    return notificationsMarkReadAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON orgDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -845,6 +1676,14 @@ namespace dx {
     return orgDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgFindMembers(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/findMembers"), input_params, safe_to_retry);
   }
@@ -853,6 +1692,14 @@ namespace dx {
     return orgFindMembers(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgFindMembersAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/findMembers"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgFindMembersAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgFindMembersAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgFindProjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/findProjects"), input_params, safe_to_retry);
   }
@@ -861,6 +1708,14 @@ namespace dx {
     return orgFindProjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgFindProjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/findProjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgFindProjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgFindProjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgFindApps(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/findApps"), input_params, safe_to_retry);
   }
@@ -869,6 +1724,14 @@ namespace dx {
     return orgFindApps(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgFindAppsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/findApps"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgFindAppsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgFindAppsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgInvite(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/invite"), input_params, safe_to_retry);
   }
@@ -877,6 +1740,14 @@ namespace dx {
     return orgInvite(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgInviteAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/invite"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgInviteAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgInviteAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgRemoveMember(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeMember"), input_params, safe_to_retry);
   }
@@ -885,6 +1756,14 @@ namespace dx {
     return orgRemoveMember(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgRemoveMemberAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeMember"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgRemoveMemberAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgRemoveMemberAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgSetMemberAccess(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setMemberAccess"), input_params, safe_to_retry);
   }
@@ -893,6 +1772,14 @@ namespace dx {
     return orgSetMemberAccess(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgSetMemberAccessAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setMemberAccess"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgSetMemberAccessAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgSetMemberAccessAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgUpdate(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
   }
@@ -901,6 +1788,14 @@ namespace dx {
     return orgUpdate(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgUpdateAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgUpdateAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return orgUpdateAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON orgNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/org/new", input_params, safe_to_retry);
   }
@@ -910,6 +1805,15 @@ namespace dx {
     return orgNew(input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> orgNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/org/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> orgNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return orgNewAsync(input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON projectAddTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -918,6 +1822,14 @@ namespace dx {
     return projectAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectClone(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/clone"), input_params, safe_to_retry);
   }
@@ -926,6 +1838,14 @@ namespace dx {
     return projectClone(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectCloneAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/clone"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectCloneAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectCloneAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectDecreasePermissions(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/decreasePermissions"), input_params, safe_to_retry);
   }
@@ -934,6 +1854,14 @@ namespace dx {
     return projectDecreasePermissions(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectDecreasePermissionsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/decreasePermissions"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectDecreasePermissionsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectDecreasePermissionsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -942,6 +1870,14 @@ namespace dx {
     return projectDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectDestroy(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/destroy"), input_params, safe_to_retry);
   }
@@ -950,6 +1886,14 @@ namespace dx {
     return projectDestroy(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectDestroyAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/destroy"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectDestroyAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectDestroyAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectInvite(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/invite"), input_params, safe_to_retry);
   }
@@ -958,6 +1902,14 @@ namespace dx {
     return projectInvite(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectInviteAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/invite"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectInviteAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectInviteAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectLeave(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/leave"), input_params, safe_to_retry);
   }
@@ -966,6 +1918,14 @@ namespace dx {
     return projectLeave(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectLeaveAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/leave"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectLeaveAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectLeaveAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectListFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/listFolder"), input_params, safe_to_retry);
   }
@@ -974,6 +1934,14 @@ namespace dx {
     return projectListFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectListFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/listFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectListFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectListFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectMove(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/move"), input_params, safe_to_retry);
   }
@@ -982,6 +1950,14 @@ namespace dx {
     return projectMove(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectMoveAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/move"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectMoveAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectMoveAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectNewFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/newFolder"), input_params, safe_to_retry);
   }
@@ -990,6 +1966,14 @@ namespace dx {
     return projectNewFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectNewFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/newFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectNewFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectNewFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectRemoveFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeFolder"), input_params, safe_to_retry);
   }
@@ -998,6 +1982,14 @@ namespace dx {
     return projectRemoveFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectRemoveFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectRemoveFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectRemoveFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectRemoveObjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeObjects"), input_params, safe_to_retry);
   }
@@ -1006,6 +1998,14 @@ namespace dx {
     return projectRemoveObjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectRemoveObjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeObjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectRemoveObjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectRemoveObjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -1014,6 +2014,14 @@ namespace dx {
     return projectRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectRenameFolder(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/renameFolder"), input_params, safe_to_retry);
   }
@@ -1022,6 +2030,14 @@ namespace dx {
     return projectRenameFolder(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectRenameFolderAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/renameFolder"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectRenameFolderAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectRenameFolderAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -1030,6 +2046,14 @@ namespace dx {
     return projectSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectTransfer(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/transfer"), input_params, safe_to_retry);
   }
@@ -1038,6 +2062,14 @@ namespace dx {
     return projectTransfer(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectTransferAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/transfer"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectTransferAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectTransferAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectUpdate(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
   }
@@ -1046,6 +2078,14 @@ namespace dx {
     return projectUpdate(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectUpdateAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectUpdateAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectUpdateAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectUpdateSponsorship(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/updateSponsorship"), input_params, safe_to_retry);
   }
@@ -1054,6 +2094,14 @@ namespace dx {
     return projectUpdateSponsorship(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectUpdateSponsorshipAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/updateSponsorship"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectUpdateSponsorshipAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return projectUpdateSponsorshipAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON projectNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/project/new", input_params, safe_to_retry);
   }
@@ -1062,6 +2110,14 @@ namespace dx {
     return projectNew(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> projectNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/project/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> projectNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    return projectNewAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON recordAddTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -1070,6 +2126,14 @@ namespace dx {
     return recordAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordAddTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
   }
@@ -1078,6 +2142,14 @@ namespace dx {
     return recordAddTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordAddTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordAddTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordAddTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordClose(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
   }
@@ -1086,6 +2158,14 @@ namespace dx {
     return recordClose(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordCloseAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordCloseAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordCloseAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -1094,6 +2174,14 @@ namespace dx {
     return recordDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordGetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
   }
@@ -1102,6 +2190,14 @@ namespace dx {
     return recordGetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordGetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordGetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordGetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordListProjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
   }
@@ -1110,6 +2206,14 @@ namespace dx {
     return recordListProjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordListProjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordListProjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordListProjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -1118,6 +2222,14 @@ namespace dx {
     return recordRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordRemoveTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
   }
@@ -1126,6 +2238,14 @@ namespace dx {
     return recordRemoveTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordRemoveTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordRemoveTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordRemoveTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordRename(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
   }
@@ -1134,6 +2254,14 @@ namespace dx {
     return recordRename(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordRenameAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordRenameAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordRenameAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordSetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
   }
@@ -1142,6 +2270,14 @@ namespace dx {
     return recordSetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordSetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordSetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordSetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -1150,6 +2286,14 @@ namespace dx {
     return recordSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordSetVisibility(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
   }
@@ -1158,6 +2302,14 @@ namespace dx {
     return recordSetVisibility(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordSetVisibilityAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordSetVisibilityAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return recordSetVisibilityAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON recordNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/record/new", input_params, safe_to_retry);
   }
@@ -1167,6 +2319,15 @@ namespace dx {
     return recordNew(input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> recordNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/record/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> recordNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return recordNewAsync(input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON systemDescribeDataObjects(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/describeDataObjects", input_params, safe_to_retry);
   }
@@ -1175,6 +2336,14 @@ namespace dx {
     return systemDescribeDataObjects(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemDescribeDataObjectsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/describeDataObjects", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemDescribeDataObjectsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemDescribeDataObjectsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemDescribeExecutions(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/describeExecutions", input_params, safe_to_retry);
   }
@@ -1183,6 +2352,14 @@ namespace dx {
     return systemDescribeExecutions(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemDescribeExecutionsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/describeExecutions", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemDescribeExecutionsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemDescribeExecutionsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemDescribeProjects(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/describeProjects", input_params, safe_to_retry);
   }
@@ -1191,6 +2368,14 @@ namespace dx {
     return systemDescribeProjects(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemDescribeProjectsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/describeProjects", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemDescribeProjectsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemDescribeProjectsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindAffiliates(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findAffiliates", input_params, safe_to_retry);
   }
@@ -1199,6 +2384,14 @@ namespace dx {
     return systemFindAffiliates(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindAffiliatesAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findAffiliates", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindAffiliatesAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindAffiliatesAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindApps(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findApps", input_params, safe_to_retry);
   }
@@ -1207,6 +2400,14 @@ namespace dx {
     return systemFindApps(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindAppsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findApps", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindAppsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindAppsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindDataObjects(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findDataObjects", input_params, safe_to_retry);
   }
@@ -1215,6 +2416,14 @@ namespace dx {
     return systemFindDataObjects(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindDataObjectsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findDataObjects", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindDataObjectsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindDataObjectsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemResolveDataObjects(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/resolveDataObjects", input_params, safe_to_retry);
   }
@@ -1223,6 +2432,14 @@ namespace dx {
     return systemResolveDataObjects(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemResolveDataObjectsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/resolveDataObjects", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemResolveDataObjectsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemResolveDataObjectsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindExecutions(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findExecutions", input_params, safe_to_retry);
   }
@@ -1231,6 +2448,14 @@ namespace dx {
     return systemFindExecutions(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindExecutionsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findExecutions", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindExecutionsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindExecutionsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindAnalyses(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findAnalyses", input_params, safe_to_retry);
   }
@@ -1239,6 +2464,14 @@ namespace dx {
     return systemFindAnalyses(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindAnalysesAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findAnalyses", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindAnalysesAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindAnalysesAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindJobs(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findJobs", input_params, safe_to_retry);
   }
@@ -1247,6 +2480,14 @@ namespace dx {
     return systemFindJobs(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindJobsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findJobs", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindJobsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindJobsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindProjects(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findProjects", input_params, safe_to_retry);
   }
@@ -1255,6 +2496,14 @@ namespace dx {
     return systemFindProjects(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindProjectsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findProjects", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindProjectsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindProjectsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindUsers(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findUsers", input_params, safe_to_retry);
   }
@@ -1263,6 +2512,14 @@ namespace dx {
     return systemFindUsers(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindUsersAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findUsers", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindUsersAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindUsersAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindProjectMembers(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findProjectMembers", input_params, safe_to_retry);
   }
@@ -1271,6 +2528,14 @@ namespace dx {
     return systemFindProjectMembers(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindProjectMembersAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findProjectMembers", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindProjectMembersAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindProjectMembersAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemFindOrgs(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/findOrgs", input_params, safe_to_retry);
   }
@@ -1279,6 +2544,14 @@ namespace dx {
     return systemFindOrgs(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemFindOrgsAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/findOrgs", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemFindOrgsAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemFindOrgsAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemGlobalSearch(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/globalSearch", input_params, safe_to_retry);
   }
@@ -1287,6 +2560,14 @@ namespace dx {
     return systemGlobalSearch(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemGlobalSearchAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/globalSearch", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemGlobalSearchAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemGlobalSearchAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemGreet(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/greet", input_params, safe_to_retry);
   }
@@ -1295,6 +2576,14 @@ namespace dx {
     return systemGreet(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemGreetAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/greet", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemGreetAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemGreetAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemHeaders(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/headers", input_params, safe_to_retry);
   }
@@ -1303,6 +2592,14 @@ namespace dx {
     return systemHeaders(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemHeadersAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/headers", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemHeadersAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemHeadersAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemShortenURL(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/shortenURL", input_params, safe_to_retry);
   }
@@ -1311,6 +2608,14 @@ namespace dx {
     return systemShortenURL(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemShortenURLAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/shortenURL", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemShortenURLAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemShortenURLAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON systemWhoami(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/system/whoami", input_params, safe_to_retry);
   }
@@ -1319,6 +2624,14 @@ namespace dx {
     return systemWhoami(input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> systemWhoamiAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/system/whoami", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> systemWhoamiAsync(const JSON &input_params, const bool safe_to_retry) {
+    return systemWhoamiAsync(input_params.toString(), safe_to_retry);
+  }
+
   JSON userDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -1327,6 +2640,14 @@ namespace dx {
     return userDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> userDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> userDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return userDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON userUpdate(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
   }
@@ -1335,6 +2656,14 @@ namespace dx {
     return userUpdate(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> userUpdateAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> userUpdateAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return userUpdateAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowAddStage(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addStage"), input_params, safe_to_retry);
   }
@@ -1343,6 +2672,14 @@ namespace dx {
     return workflowAddStage(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowAddStageAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addStage"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowAddStageAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowAddStageAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowAddTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
   }
@@ -1351,6 +2688,14 @@ namespace dx {
     return workflowAddTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowAddTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowAddTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowAddTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowAddTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
   }
@@ -1359,6 +2704,14 @@ namespace dx {
     return workflowAddTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowAddTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/addTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowAddTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowAddTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowClose(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
   }
@@ -1367,6 +2720,14 @@ namespace dx {
     return workflowClose(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowCloseAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/close"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowCloseAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowCloseAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowDescribe(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
   }
@@ -1375,6 +2736,14 @@ namespace dx {
     return workflowDescribe(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowDescribeAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/describe"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowDescribeAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowDescribeAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowDryRun(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/dryRun"), input_params, safe_to_retry);
   }
@@ -1383,6 +2752,14 @@ namespace dx {
     return workflowDryRun(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowDryRunAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/dryRun"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowDryRunAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowDryRunAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowGetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
   }
@@ -1391,6 +2768,14 @@ namespace dx {
     return workflowGetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowGetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/getDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowGetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowGetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowIsStageCompatible(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/isStageCompatible"), input_params, safe_to_retry);
   }
@@ -1399,6 +2784,14 @@ namespace dx {
     return workflowIsStageCompatible(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowIsStageCompatibleAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/isStageCompatible"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowIsStageCompatibleAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowIsStageCompatibleAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowListProjects(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
   }
@@ -1407,6 +2800,14 @@ namespace dx {
     return workflowListProjects(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowListProjectsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/listProjects"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowListProjectsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowListProjectsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowMoveStage(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/moveStage"), input_params, safe_to_retry);
   }
@@ -1415,6 +2816,14 @@ namespace dx {
     return workflowMoveStage(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowMoveStageAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/moveStage"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowMoveStageAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowMoveStageAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowOverwrite(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/overwrite"), input_params, safe_to_retry);
   }
@@ -1423,6 +2832,14 @@ namespace dx {
     return workflowOverwrite(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowOverwriteAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/overwrite"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowOverwriteAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowOverwriteAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowRemoveStage(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeStage"), input_params, safe_to_retry);
   }
@@ -1431,6 +2848,14 @@ namespace dx {
     return workflowRemoveStage(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowRemoveStageAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeStage"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowRemoveStageAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowRemoveStageAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowRemoveTags(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
   }
@@ -1439,6 +2864,14 @@ namespace dx {
     return workflowRemoveTags(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowRemoveTagsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTags"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowRemoveTagsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowRemoveTagsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowRemoveTypes(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
   }
@@ -1447,6 +2880,14 @@ namespace dx {
     return workflowRemoveTypes(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowRemoveTypesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/removeTypes"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowRemoveTypesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowRemoveTypesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowRename(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
   }
@@ -1455,6 +2896,14 @@ namespace dx {
     return workflowRename(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowRenameAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/rename"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowRenameAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowRenameAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowRun(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/run"), input_params, safe_to_retry);
   }
@@ -1464,6 +2913,15 @@ namespace dx {
     return workflowRun(object_id, input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowRunAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/run"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowRunAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return workflowRunAsync(object_id, input_params_cp.toString(), safe_to_retry);
+  }
+
   JSON workflowSetDetails(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
   }
@@ -1472,6 +2930,14 @@ namespace dx {
     return workflowSetDetails(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowSetDetailsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setDetails"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowSetDetailsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowSetDetailsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowSetProperties(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
   }
@@ -1480,6 +2946,14 @@ namespace dx {
     return workflowSetProperties(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowSetPropertiesAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setProperties"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowSetPropertiesAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowSetPropertiesAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowSetStageInputs(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setStageInputs"), input_params, safe_to_retry);
   }
@@ -1488,6 +2962,14 @@ namespace dx {
     return workflowSetStageInputs(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowSetStageInputsAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setStageInputs"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowSetStageInputsAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowSetStageInputsAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowSetVisibility(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
   }
@@ -1496,6 +2978,14 @@ namespace dx {
     return workflowSetVisibility(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowSetVisibilityAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/setVisibility"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowSetVisibilityAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowSetVisibilityAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowUpdate(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
   }
@@ -1504,6 +2994,14 @@ namespace dx {
     return workflowUpdate(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowUpdateAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/update"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowUpdateAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowUpdateAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowUpdateStageExecutable(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest(std::string("/") + object_id + std::string("/updateStageExecutable"), input_params, safe_to_retry);
   }
@@ -1512,6 +3010,14 @@ namespace dx {
     return workflowUpdateStageExecutable(object_id, input_params.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowUpdateStageExecutableAsync(const std::string &object_id, const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync(std::string("/") + object_id + std::string("/updateStageExecutable"), input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowUpdateStageExecutableAsync(const std::string &object_id, const JSON &input_params, const bool safe_to_retry) {
+    return workflowUpdateStageExecutableAsync(object_id, input_params.toString(), safe_to_retry);
+  }
+
   JSON workflowNew(const std::string &input_params, const bool safe_to_retry) {
     return DXHTTPRequest("/workflow/new", input_params, safe_to_retry);
   }
@@ -1521,4 +3027,13 @@ namespace dx {
     return workflowNew(input_params_cp.toString(), safe_to_retry);
   }
 
+  std::future<JSON> workflowNewAsync(const std::string &input_params, const bool safe_to_retry) {
+    return DXHTTPRequestAsync("/workflow/new", input_params, safe_to_retry);
+  }
+
+  std::future<JSON> workflowNewAsync(const JSON &input_params, const bool safe_to_retry) {
+    JSON input_params_cp = Nonce::updateNonce(input_params);
+    return workflowNewAsync(input_params_cp.toString(), safe_to_retry);
+  }
+
 }
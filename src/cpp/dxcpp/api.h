@@ -10,7 +10,9 @@
  * JSON of an empty dict will be sent). safe_to_retry specifies whether the
  * request is idempotent and can be retried.
  *
- * Each function returns the JSON that is returned by the API server.
+ * Each function returns the JSON that is returned by the API server. The
+ * functions with an "Async" suffix return immediately, with a future for it
+ * instead (see dx::DXHTTPRequestAsync()).
  */
 
 // ===> Do not modify this file by hand! <===
@@ -22,554 +24,931 @@
 #ifndef DXCPP_API_H
 #define DXCPP_API_H
 
+#include <future>
 #include "dxjson/dxjson.h"
 
 namespace dx {
 
   JSON analysisAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON analysisAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> analysisAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> analysisAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON analysisDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON analysisDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> analysisDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> analysisDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON analysisRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON analysisRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> analysisRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> analysisRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON analysisSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON analysisSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> analysisSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> analysisSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON analysisTerminate(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON analysisTerminate(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> analysisTerminateAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> analysisTerminateAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appAddAuthorizedUsers(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddAuthorizedUsers(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appAddAuthorizedUsersWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddAuthorizedUsersWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddAuthorizedUsersAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddAuthorizedUsersAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appAddCategories(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddCategories(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appAddCategoriesWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddCategoriesWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddCategoriesAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddCategoriesAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appAddDevelopers(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddDevelopers(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appAddDevelopersWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddDevelopersWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddDevelopersAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddDevelopersAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appAddTags(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddTags(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appAddTagsWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appAddTagsWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddTagsAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddTagsAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appAddTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appAddTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appDelete(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appDelete(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appDeleteWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appDeleteWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appDeleteAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appDeleteAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appDeleteWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appDeleteWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appDescribe(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appDescribe(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appDescribeWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appDescribeWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appDescribeAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appDescribeAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appDescribeWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appDescribeWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appGet(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appGet(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appGetWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appGetWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appGetAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appGetAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appGetWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appGetWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appInstall(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appInstall(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appInstallWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appInstallWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appInstallAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appInstallAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appInstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appInstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appListAuthorizedUsers(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appListAuthorizedUsers(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appListAuthorizedUsersWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appListAuthorizedUsersWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appListAuthorizedUsersAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appListAuthorizedUsersAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appListAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appListAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appListCategories(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appListCategories(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appListCategoriesWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appListCategoriesWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appListCategoriesAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appListCategoriesAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appListCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appListCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appListDevelopers(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appListDevelopers(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appListDevelopersWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appListDevelopersWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appListDevelopersAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appListDevelopersAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appListDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appListDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appPublish(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appPublish(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appPublishWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appPublishWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appPublishAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appPublishAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appPublishWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appPublishWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appRemoveAuthorizedUsers(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveAuthorizedUsers(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appRemoveAuthorizedUsersWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveAuthorizedUsersWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveAuthorizedUsersAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveAuthorizedUsersAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveAuthorizedUsersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appRemoveCategories(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveCategories(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appRemoveCategoriesWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveCategoriesWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveCategoriesAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveCategoriesAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveCategoriesWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appRemoveDevelopers(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveDevelopers(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appRemoveDevelopersWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveDevelopersWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveDevelopersAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveDevelopersAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveDevelopersWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appRemoveTags(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveTags(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appRemoveTagsWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appRemoveTagsWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveTagsAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveTagsAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appRemoveTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appRemoveTagsWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appRun(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON appRun(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=false);
   JSON appRunWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON appRunWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> appRunAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> appRunAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> appRunWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> appRunWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON appUninstall(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appUninstall(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appUninstallWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appUninstallWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appUninstallAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appUninstallAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appUninstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appUninstallWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appUpdate(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appUpdate(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
   JSON appUpdateWithAlias(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appUpdateWithAlias(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appUpdateAsync(const std::string &app_id_or_name, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appUpdateAsync(const std::string &app_id_or_name, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appUpdateWithAliasAsync(const std::string &app_name, const std::string &app_alias, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appUpdateWithAliasAsync(const std::string &app_name, const std::string &app_alias, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON appNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> appNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> appNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON appletAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletGet(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletGet(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletGetAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletGetAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletGetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletGetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletGetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletGetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletListProjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletListProjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletListProjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletListProjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletRename(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletRename(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletRenameAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletRenameAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletRun(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON appletRun(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> appletRunAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> appletRunAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON appletSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON appletSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> appletSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> appletSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON appletNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON appletNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> appletNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> appletNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON containerClone(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON containerClone(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> containerCloneAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> containerCloneAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON containerDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON containerDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> containerDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> containerDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON containerDestroy(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON containerDestroy(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> containerDestroyAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> containerDestroyAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON containerListFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON containerListFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> containerListFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> containerListFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON containerMove(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON containerMove(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> containerMoveAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> containerMoveAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON containerNewFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON containerNewFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> containerNewFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> containerNewFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON containerRemoveFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON containerRemoveFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> containerRemoveFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> containerRemoveFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON containerRemoveObjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON containerRemoveObjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> containerRemoveObjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> containerRemoveObjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON containerRenameFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON containerRenameFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> containerRenameFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> containerRenameFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON fileAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileAddTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileAddTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileAddTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileAddTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileClose(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileClose(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileCloseAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileCloseAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileDownload(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileDownload(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileDownloadAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileDownloadAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileGetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileGetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileGetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileGetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileListProjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileListProjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileListProjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileListProjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileRemoveTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileRemoveTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileRemoveTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileRemoveTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileRename(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileRename(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileRenameAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileRenameAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileSetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileSetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileSetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileSetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileSetVisibility(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileSetVisibility(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileSetVisibilityAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileSetVisibilityAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileUpload(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON fileUpload(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> fileUploadAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> fileUploadAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON fileNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON fileNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> fileNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> fileNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON gtableAddRows(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableAddRows(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableAddRowsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableAddRowsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableAddTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableAddTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableAddTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableAddTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableClose(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableClose(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableCloseAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableCloseAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableGet(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableGet(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableGetAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableGetAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableGetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableGetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableGetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableGetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableListProjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableListProjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableListProjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableListProjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableNextPart(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableNextPart(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableNextPartAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableNextPartAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableRemoveTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableRemoveTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableRemoveTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableRemoveTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableRename(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableRename(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableRenameAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableRenameAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableSetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableSetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableSetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableSetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableSetVisibility(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON gtableSetVisibility(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> gtableSetVisibilityAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> gtableSetVisibilityAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON gtableNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON gtableNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> gtableNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> gtableNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON jobAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON jobAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> jobAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> jobAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON jobDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON jobDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> jobDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> jobDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON jobGetLog(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON jobGetLog(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> jobGetLogAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> jobGetLogAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON jobRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON jobRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> jobRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> jobRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON jobSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON jobSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> jobSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> jobSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON jobTerminate(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON jobTerminate(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> jobTerminateAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> jobTerminateAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON jobNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON jobNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> jobNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> jobNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON notificationsGet(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON notificationsGet(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> notificationsGetAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> notificationsGetAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON notificationsMarkRead(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON notificationsMarkRead(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> notificationsMarkReadAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> notificationsMarkReadAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgFindMembers(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgFindMembers(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgFindMembersAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgFindMembersAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgFindProjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgFindProjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgFindProjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgFindProjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgFindApps(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgFindApps(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgFindAppsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgFindAppsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgInvite(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgInvite(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgInviteAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgInviteAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgRemoveMember(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgRemoveMember(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgRemoveMemberAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgRemoveMemberAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgSetMemberAccess(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgSetMemberAccess(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgSetMemberAccessAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgSetMemberAccessAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgUpdate(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON orgUpdate(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> orgUpdateAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> orgUpdateAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON orgNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON orgNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> orgNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> orgNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON projectAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectClone(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON projectClone(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> projectCloneAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> projectCloneAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON projectDecreasePermissions(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectDecreasePermissions(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectDecreasePermissionsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectDecreasePermissionsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectDestroy(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectDestroy(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectDestroyAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectDestroyAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectInvite(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON projectInvite(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> projectInviteAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> projectInviteAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON projectLeave(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectLeave(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectLeaveAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectLeaveAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectListFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectListFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectListFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectListFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectMove(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON projectMove(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> projectMoveAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> projectMoveAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON projectNewFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectNewFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectNewFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectNewFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectRemoveFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON projectRemoveFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> projectRemoveFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> projectRemoveFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON projectRemoveObjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON projectRemoveObjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> projectRemoveObjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> projectRemoveObjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON projectRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectRenameFolder(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON projectRenameFolder(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> projectRenameFolderAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> projectRenameFolderAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON projectSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectTransfer(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectTransfer(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectTransferAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectTransferAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectUpdate(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectUpdate(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectUpdateAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectUpdateAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectUpdateSponsorship(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON projectUpdateSponsorship(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> projectUpdateSponsorshipAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> projectUpdateSponsorshipAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON projectNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON projectNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> projectNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> projectNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON recordAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordAddTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordAddTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordAddTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordAddTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordClose(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordClose(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordCloseAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordCloseAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordGetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordGetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordGetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordGetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordListProjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordListProjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordListProjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordListProjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordRemoveTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordRemoveTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordRemoveTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordRemoveTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordRename(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordRename(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordRenameAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordRenameAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordSetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordSetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordSetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordSetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordSetVisibility(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON recordSetVisibility(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> recordSetVisibilityAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> recordSetVisibilityAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON recordNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON recordNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> recordNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> recordNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON systemDescribeDataObjects(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemDescribeDataObjects(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemDescribeDataObjectsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemDescribeDataObjectsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemDescribeExecutions(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemDescribeExecutions(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemDescribeExecutionsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemDescribeExecutionsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemDescribeProjects(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemDescribeProjects(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemDescribeProjectsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemDescribeProjectsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindAffiliates(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindAffiliates(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindAffiliatesAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindAffiliatesAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindApps(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindApps(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindAppsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindAppsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindDataObjects(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindDataObjects(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindDataObjectsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindDataObjectsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemResolveDataObjects(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemResolveDataObjects(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemResolveDataObjectsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemResolveDataObjectsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindExecutions(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindExecutions(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindExecutionsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindExecutionsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindAnalyses(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindAnalyses(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindAnalysesAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindAnalysesAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindJobs(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindJobs(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindJobsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindJobsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindProjects(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindProjects(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindProjectsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindProjectsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindUsers(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindUsers(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindUsersAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindUsersAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindProjectMembers(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindProjectMembers(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindProjectMembersAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindProjectMembersAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemFindOrgs(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemFindOrgs(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemFindOrgsAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemFindOrgsAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemGlobalSearch(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemGlobalSearch(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemGlobalSearchAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemGlobalSearchAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemGreet(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemGreet(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemGreetAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemGreetAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemHeaders(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemHeaders(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemHeadersAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemHeadersAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemShortenURL(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemShortenURL(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemShortenURLAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemShortenURLAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON systemWhoami(const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON systemWhoami(const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> systemWhoamiAsync(const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> systemWhoamiAsync(const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON userDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON userDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> userDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> userDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON userUpdate(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON userUpdate(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> userUpdateAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> userUpdateAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON workflowAddStage(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowAddStage(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowAddStageAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowAddStageAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowAddTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowAddTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowAddTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowAddTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowAddTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowAddTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowAddTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowAddTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowClose(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowClose(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowCloseAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowCloseAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowDescribe(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowDescribe(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowDescribeAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowDescribeAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowDryRun(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowDryRun(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowDryRunAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowDryRunAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowGetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowGetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowGetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowGetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowIsStageCompatible(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowIsStageCompatible(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowIsStageCompatibleAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowIsStageCompatibleAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowListProjects(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowListProjects(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowListProjectsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowListProjectsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowMoveStage(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowMoveStage(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowMoveStageAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowMoveStageAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowOverwrite(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowOverwrite(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowOverwriteAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowOverwriteAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowRemoveStage(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowRemoveStage(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowRemoveStageAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowRemoveStageAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowRemoveTags(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowRemoveTags(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowRemoveTagsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowRemoveTagsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowRemoveTypes(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowRemoveTypes(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowRemoveTypesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowRemoveTypesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowRename(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowRename(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowRenameAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowRenameAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowRun(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON workflowRun(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> workflowRunAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> workflowRunAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=false);
 
   JSON workflowSetDetails(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowSetDetails(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowSetDetailsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowSetDetailsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowSetProperties(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowSetProperties(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowSetPropertiesAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowSetPropertiesAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowSetStageInputs(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowSetStageInputs(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowSetStageInputsAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowSetStageInputsAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowSetVisibility(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowSetVisibility(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowSetVisibilityAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowSetVisibilityAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowUpdate(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowUpdate(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowUpdateAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowUpdateAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowUpdateStageExecutable(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
   JSON workflowUpdateStageExecutable(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
+  std::future<JSON> workflowUpdateStageExecutableAsync(const std::string &object_id, const std::string &input_params="{}", const bool safe_to_retry=true);
+  std::future<JSON> workflowUpdateStageExecutableAsync(const std::string &object_id, const dx::JSON &input_params, const bool safe_to_retry=true);
 
   JSON workflowNew(const std::string &input_params="{}", const bool safe_to_retry=false);
   JSON workflowNew(const dx::JSON &input_params, const bool safe_to_retry=false);
+  std::future<JSON> workflowNewAsync(const std::string &input_params="{}", const bool safe_to_retry=false);
+  std::future<JSON> workflowNewAsync(const dx::JSON &input_params, const bool safe_to_retry=false);
 
 }
 #include "dxcpp.h"
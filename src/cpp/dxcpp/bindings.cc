@@ -132,7 +132,7 @@ namespace dx {
   }
 
   dx::JSON DXDataObject::getProperties() const {
-    return describe(true)["properties"];
+    return std::move(describe(true)["properties"]);
   }
 
   void DXDataObject::addTags(const dx::JSON &tags) const {
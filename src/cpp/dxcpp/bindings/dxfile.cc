@@ -22,12 +22,31 @@
 #include "../utils.h"
 #include "SimpleHttp.h"
 #include "../dxlog.h"
+#include "dxjson/json_binding.h"
 
 using namespace std;
 
+namespace {
+  // Fields of a /file-xxxx/download response used by DXFile
+  struct FileDownloadURL {
+    string url;
+    map<string, string> headers;
+  };
+}
+
+DX_JSON_FIELDS(FileDownloadURL, url, headers)
+
 namespace dx {
+  static FileDownloadURL getDownloadURL(const string &dxid) {
+    LazyJSONDocument resp;
+    DXHTTPRequest("/" + dxid + "/download", "{\"preauthenticated\": false}", resp, true);
+    FileDownloadURL dl;
+    fromJSON(resp.root(), dl);
+    return dl;
+  }
+
   // A helper function for making http requests with retry logic
-  void makeHTTPRequestForFileReadAndWrite(HttpRequest &resp, const string &url, const HttpHeaders &headers, const HttpMethod &method, const char *data = NULL, const size_t size=0u, const int MAX_TRIES = 5) {
+  void makeHTTPRequestForFileReadAndWrite(HttpRequest &resp, const string &url, const HttpHeaders &headers, const HttpMethod &method, const char *data = NULL, const size_t size=0u, const int MAX_TRIES = 5, HttpBodySink *bodySink = NULL) {
     DXLOG(logDEBUG) << "In makeHTTPRequestForFileReadAndWrite(), inputs:" << endl
                     << " --url = '" << url << "'" << endl
                     << " --MAX_TRIES = " << MAX_TRIES << endl
@@ -39,7 +58,7 @@ namespace dx {
     while (true) {
       try {
         DXLOG(logDEBUG) << "Attempting the actual HTTP request ...";
-        resp = HttpRequest::request(method, url, headers, data, size);
+        resp = HttpRequest::request(method, url, headers, data, size, bodySink);
         DXLOG(logDEBUG) << "Request completed, responseCode = '" << resp.responseCode << "'";
       } catch(HttpRequestException e) {
         DXLOG(logDEBUG) << "HttpRequestException thrown ... message = '" << e.what() << "'";
@@ -79,7 +98,6 @@ namespace dx {
   void DXFile::init_internals_() {
     pos_ = 0;
     file_length_ = -1;
-    buffer_.str(string());
     buffer_.clear();
     cur_part_ = 1;
     eof_ = false;
@@ -144,10 +162,7 @@ namespace dx {
 
   void DXFile::read(char* ptr, int64_t n) {
     gcount_ = 0;
-    JSON req(JSON_HASH);
-    req["preauthenticated"] = false;
-    const JSON dlResp = fileDownload(dxid_, req);
-    const string url = dlResp["url"].get<string>();
+    const FileDownloadURL dl = getDownloadURL(dxid_);
 
     // TODO: make sure all lower-case works.
     if (file_length_ < 0) {
@@ -168,16 +183,17 @@ namespace dx {
 
     HttpHeaders headers;
     headers["Range"] = "bytes=" + boost::lexical_cast<string>(pos_) + "-" + boost::lexical_cast<string>(endbyte);
-    for (JSON::const_object_iterator it = dlResp["headers"].object_begin(); it != dlResp["headers"].object_end(); ++it)
-      headers[it->first] = it->second.get<string>();
+    for (map<string, string>::const_iterator it = dl.headers.begin(); it != dl.headers.end(); ++it)
+      headers[it->first] = it->second;
 
+    // Body is received directly in "ptr"
+    HttpBufferSink sink(ptr, endbyte - pos_ + 1);
     pos_ = endbyte + 1;
 
     HttpRequest resp;
-    makeHTTPRequestForFileReadAndWrite(resp, url, headers, HTTP_GET);
+    makeHTTPRequestForFileReadAndWrite(resp, dl.url, headers, HTTP_GET, NULL, 0u, 5, &sink);
 
-    memcpy(ptr, resp.respData.data(), resp.respData.length());
-    gcount_ = resp.respData.length();
+    gcount_ = sink.size;
   }
 
   /////////////////////////////////////////////////////////////////////////////////
@@ -197,11 +213,9 @@ namespace dx {
     lq_results_.clear();
     lq_headers.clear();
     
-    JSON req(JSON_HASH);
-    req["preauthenticated"] = false;
-    const JSON dlResp = fileDownload(dxid_, req);
-    lq_url = dlResp["url"].get<string>();
-    lq_headers = dlResp["headers"];
+    FileDownloadURL dl = getDownloadURL(dxid_);
+    lq_url.swap(dl.url);
+    lq_headers.swap(dl.headers);
 
     for (unsigned i = 0; i < thread_count; ++i)
       lq_readThreads_.push_back(boost::thread(boost::bind(&DXFile::readChunk_, this)));
@@ -210,24 +224,23 @@ namespace dx {
   // Do *NOT* call this function with value of "end" past the (last - 1) byte of file, i.e.,
   // the Range: [start,end] should be a valid byte range in file (shouldn't be past the end of file)
   void DXFile::getChunkHttp_(int64_t start, int64_t end, string &result) const {
+    // Body is received directly in "result" (possibly in more than one request,
+    // if server returns less than the requested range)
+    result.resize(end - start + 1);
     int64_t last_byte_in_result = start - 1;
 
     while (last_byte_in_result < end) {
       HttpHeaders headers;
       string range = boost::lexical_cast<string>(last_byte_in_result + 1) + "-" + boost::lexical_cast<string>(end);
       headers["Range"] = "bytes=" + range;
-      for (JSON::const_object_iterator it = lq_headers.object_begin(); it != lq_headers.object_end(); ++it)
-        headers[it->first] = it->second.get<string>();
+      for (map<string, string>::const_iterator it = lq_headers.begin(); it != lq_headers.end(); ++it)
+        headers[it->first] = it->second;
 
+      HttpBufferSink sink(&result[last_byte_in_result + 1 - start], end - last_byte_in_result);
       HttpRequest resp;
-      makeHTTPRequestForFileReadAndWrite(resp, lq_url, headers, HTTP_GET);
-
-      if (result == "")
-        result = resp.respData;
-      else
-        result.append(resp.respData);
+      makeHTTPRequestForFileReadAndWrite(resp, lq_url, headers, HTTP_GET, NULL, 0u, 5, &sink);
 
-      last_byte_in_result += resp.respData.size();
+      last_byte_in_result += sink.size;
     }
     assert(result.size() == (end - start + 1));
   }
@@ -254,7 +267,7 @@ namespace dx {
         boost::this_thread::sleep(boost::posix_time::milliseconds(1));
         r_lock.lock();
       }
-      lq_results_[start] = tmp;
+      lq_results_[start].swap(tmp);
       r_lock.unlock();
       boost::this_thread::interruption_point();
     }
@@ -277,7 +290,7 @@ namespace dx {
 #endif
       r_lock.lock();
     }
-    chunk = lq_results_.begin()->second;
+    chunk = std::move(lq_results_.begin()->second);
     lq_results_.erase(lq_results_.begin());
     lq_next_result_ += chunk.size();
     r_lock.unlock();
@@ -441,18 +454,18 @@ namespace dx {
   // NOTE: If needed, optimize in the future to not have to copy to
   // append to buffer_ before uploading the next part.
   void DXFile::write(const char* ptr, int64_t n) {
-    int64_t remaining_buf_size = max_buf_size_ - buffer_.tellp();
+    int64_t remaining_buf_size = max_buf_size_ - buffer_.size();
     if (n < remaining_buf_size) {
-      buffer_.write(ptr, n);
+      buffer_.append(ptr, n);
     } else {
-      buffer_.write(ptr, remaining_buf_size);
+      buffer_.append(ptr, remaining_buf_size);
       // Create thread pool (if not already created)
       if (writeThreads.size() == 0)
         createWriteThreads_();
       
       // add upload request for this part to blocking queue
-      uploadPartRequestsQueue.produce(make_pair(buffer_.str(), cur_part_));
-      buffer_.str(string()); // clear the buffer
+      uploadPartRequestsQueue.produce(make_pair(std::move(buffer_), cur_part_));
+      buffer_.clear(); // clear the buffer (it's left in a valid, but unspecified state by move)
       cur_part_++; // increment the part number for next request
 
       // Add remaining data to buffer (will be added in next call)
@@ -466,18 +479,18 @@ namespace dx {
   }
 
   void DXFile::flush() {
-    if (buffer_.tellp() > 0) {
+    if (buffer_.size() > 0) {
       // We have some data to flush before joining all the threads
       // Create thread pool (if not already created)
       if (writeThreads.size() == 0)
          createWriteThreads_();
-      uploadPartRequestsQueue.produce(make_pair(buffer_.str(), cur_part_));
+      uploadPartRequestsQueue.produce(make_pair(std::move(buffer_), cur_part_));
       cur_part_++;
       hasAnyPartBeenUploaded = true;
     }
     // Now join all write threads
     joinAllWriteThreads_();
-    buffer_.str(string());
+    buffer_.clear();
   }
 
   //////////////////////////////////////////////////////////////////////
@@ -129,9 +129,10 @@ namespace dx {
 
     /**
      * For use when writing remote files; stores a buffer of data that
-     * will be periodically flushed to the API server.
+     * will be periodically flushed to the API server (each part is moved,
+     * not copied, to the thread uploading it).
      */
-    std::stringstream buffer_;
+    std::string buffer_;
 
     /**
      * For use when writing remote files; stores the part index to be
@@ -186,7 +187,7 @@ namespace dx {
     mutable unsigned lq_max_chunks_;
     mutable int64_t lq_next_result_;
     mutable std::string lq_url;
-    mutable dx::JSON lq_headers;
+    mutable std::map<std::string, std::string> lq_headers;
     mutable std::vector<boost::thread> lq_readThreads_;
     mutable boost::mutex lq_results_mutex_, lq_query_start_mutex_;
 
@@ -22,8 +22,8 @@ using namespace std;
 
 namespace dx {
   void DXGTable::reset_buffer_() {
-    row_buffer_.str("");
-    row_buffer_ << "{\"data\": [";
+    row_buffer_.clear(); // (keeps the capacity, for the next batch of rows)
+    row_buffer_ += "{\"data\": [";
   }
 
   void DXGTable::reset_data_processing_() {
@@ -195,7 +195,7 @@ namespace dx {
         boost::this_thread::sleep(boost::posix_time::milliseconds(1));
         r_lock.lock();
       }
-      lq_results_[start] = ret["data"];
+      lq_results_[start] = std::move(ret["data"]);
       r_lock.unlock();
       boost::this_thread::interruption_point();
     }
@@ -217,7 +217,7 @@ namespace dx {
 #endif
       r_lock.lock();
     }
-    chunk = lq_results_.begin()->second;
+    chunk = std::move(lq_results_.begin()->second);
     lq_results_.erase(lq_results_.begin());
     lq_next_result_ += chunk.size();
     r_lock.unlock();
@@ -248,10 +248,9 @@ namespace dx {
     /* This function "closes" the stringified JSON array we are keeping for
      * for buffering requests. It also creates the worker thread if not done previously
      */
-    int64_t pos = row_buffer_.tellp();
-    if (pos > 10) {
-      row_buffer_.seekp(pos - 1); // Erase the trailing comma
-      row_buffer_ << "], \"part\": " << getUnusedPartID() << "}"; 
+    if (row_buffer_.size() > 10) {
+      row_buffer_.resize(row_buffer_.size() - 1); // Erase the trailing comma
+      row_buffer_ += "], \"part\": " + boost::lexical_cast<string>(getUnusedPartID()) + "}";
     }
     // We need to create thread pool only once (i.e., if it doesn't exist already)
     if (writeThreads.size() == 0)
@@ -384,11 +383,12 @@ namespace dx {
     for (JSON::const_array_iterator iter = data.array_begin();
          iter != data.array_end();
          iter++) {
-      row_buffer_ << (*iter).toString() << ",";
+      (*iter).writeTo(row_buffer_);
+      row_buffer_ += ',';
 
-      if (row_buffer_.tellp() >= row_buffer_maxsize_) {
+      if (int64_t(row_buffer_.size()) >= row_buffer_maxsize_) {
         finalizeRequestBuffer_();
-        addRowRequestsQueue.produce(row_buffer_.str());
+        addRowRequestsQueue.produce(row_buffer_);
         reset_buffer_();  
       }
     }
@@ -400,10 +400,9 @@ namespace dx {
   }
 
   void DXGTable::flush() {
-    int64_t pos = row_buffer_.tellp();
-    if (pos > 10) {
+    if (row_buffer_.size() > 10) {
       finalizeRequestBuffer_();
-      addRowRequestsQueue.produce(row_buffer_.str());
+      addRowRequestsQueue.produce(row_buffer_);
     }
     joinAllWriteThreads_();
     reset_buffer_();
@@ -109,7 +109,8 @@ namespace dx {
     void readChunk_() const;
     /////////////////////////////////////
     
-    std::stringstream row_buffer_;
+    // Serialized rows, i.e., body of the next /addRows request
+    std::string row_buffer_;
     
     // configurable params
     int64_t row_buffer_maxsize_;
@@ -82,7 +82,7 @@ namespace dx {
     query["limit"] = 1;
     JSON res = findDataObjects(query);
     if (res["results"].size() > 0)
-      return res["results"][0];
+      return std::move(res["results"][0]);
     // No object matched the search criteria
     return JSON(JSON_NULL);
   }
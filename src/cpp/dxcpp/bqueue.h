@@ -18,6 +18,7 @@
 #define UA_BQUEUE_H
 
 #include <queue>
+#include <utility>
 #include <boost/thread.hpp>
 
 namespace dx {
@@ -75,7 +76,7 @@ namespace dx {
           canProduce.wait(lock);
         }
       }
-      chunks.push(chunk);
+      chunks.push(std::move(chunk));
     }
     canConsume.notify_all();
   }
@@ -87,7 +88,7 @@ namespace dx {
       while (chunks.empty()) {
         canConsume.wait(lock);
       }
-      chunk = chunks.front();
+      chunk = std::move(chunks.front());
       chunks.pop();
     }
     canProduce.notify_all();
@@ -26,6 +26,7 @@
 #include "SimpleHttp.h"
 #include "ignore_sigpipe.h"
 #include "utils.h"
+#include "dxutil/mapped_file.h"
 
 #include <boost/version.hpp>
 // http://www.boost.org/doc/libs/1_48_0/libs/config/doc/html/boost_config/boost_macro_reference.html
@@ -107,99 +108,169 @@ namespace dx {
     return (c == 2 || c == 5 || c == 6 || c == 7 || c == 35);
   }
 
-  // Note: We only consider 200 as a successful response, all others are considered "failures"
-  JSON DXHTTPRequest(const string &resource, const string &data, const bool safeToRetry, const map<string, string> &headers) {
-    DXLOG(logDEBUG) << "In DXHTTPRequest(), inputs:" << endl
-                  << " --resources = '" << resource << "'" << endl
-                  << " --safeToRetry = " << safeToRetry << endl
-                  << " --data = '" << data.substr(0, 100) << "'" << endl
-                  << " --headers = '" << JSON(headers).toString() << "'";
-    const unsigned int NUM_MAX_RETRIES = 5u; // maximum number of retries for an individual request
-
-    if (config::APISERVER().empty()) {
-      throw DXError("dxcpp::DXHTTPRequest()-> API server information not found. Please set DX_APISERVER_HOST, DX_APISERVER_PORT, and DX_APISERVER_PROTOCOL.", "ApiserverInfoMissing");
-    }
-
-    const JSON &ctx = config::SECURITY_CONTEXT();
-    if (ctx.type() != JSON_HASH
-        || !ctx.has("auth_token_type") || ctx["auth_token_type"].type() != JSON_STRING
-        || !ctx.has("auth_token") || ctx["auth_token"].type() != JSON_STRING) {
-      if (ctx.type() != JSON_HASH || ctx.size() == 0) {
-        throw DXError("dxcpp::DXHTTPRequest()-> DX_SECURITY_CONTEXT is either not set, or not a valid JSON", "SecurityContextNotFound");
-      } else {
-        throw DXError("dxcpp::DXHTTPRequest()-> Invalid DX_SECURITY_CONTEXT string: '" + ctx.toString() + "'", "BadSecurityContextString");
+  // Parses a successful (200) response while it is being received. A parse error
+  // is recorded (rather than thrown), so that it can be handled after the request
+  // completes, the same way as if the whole body was parsed at once.
+  // If "lazy" is not NULL, the body is just collected, and read into it at the end.
+  class JSONResponseSink: public HttpBodySink {
+  public:
+    JSONPushParser *parser; // NULL if "lazy" is set
+    LazyJSONDocument *lazy;
+    string body; // Only used if "lazy" is set
+    size_t size; // Number of bytes received
+    string head; // First few bytes of the body (for error messages)
+    string error; // Message of the JSONException thrown by parser (if any)
+
+    JSONResponseSink(JSONArena *arena, LazyJSONDocument *lazy_)
+      : parser((lazy_ != NULL) ? NULL : (arena != NULL) ? new JSONPushParser(*arena) : new JSONPushParser()), lazy(lazy_), size(0u) {}
+
+    ~JSONResponseSink() { delete parser; }
+
+    bool begin(long responseCode) {
+      if (responseCode != 200)
+        return false;
+      if (parser != NULL)
+        parser->reset();
+      body.clear();
+      size = 0u;
+      head.clear();
+      error.clear();
+      return true;
+    }
+
+    void write(const char *data, size_t len) {
+      const size_t MAX_HEAD_SIZE = 1000u;
+      if (head.size() < MAX_HEAD_SIZE)
+        head.append(data, std::min(len, MAX_HEAD_SIZE - head.size()));
+      size += len;
+      if (lazy != NULL) {
+        body.append(data, len);
+        return;
+      }
+      if (!error.empty())
+        return;
+      try {
+        parser->feed(data, len);
+      } catch (JSONException &e) {
+        error = e.what();
       }
     }
 
-    string url = config::APISERVER() + resource;
-    HttpHeaders req_headers;
-    req_headers["Authorization"] = ctx["auth_token_type"].get<string>() + " " + ctx["auth_token"].get<string>();
-    req_headers["DNAnexus-API"] = config::API_VERSION();
+    // Returns the response (throws JSONException if it was not a valid JSON).
+    // If "lazy" is set, the response is read into it instead (and JSON_UNDEFINED is returned).
+    JSON finish() {
+      if (lazy != NULL) {
+        lazy->read(std::move(body));
+        return JSON();
+      }
+      if (error.empty()) {
+        parser->finish();
+        return std::move(parser->value());
+      }
+      throw JSONException(error);
+    }
 
-    string headername;
+  private:
+    JSONResponseSink(const JSONResponseSink &);
+    JSONResponseSink& operator=(const JSONResponseSink &);
+  };
 
-    // TODO: Reconsider this; would we rather just set the content-type
-    // to json always?
-    bool content_type_set = false;
-    for (map<string, string>::const_iterator iter = headers.begin(); iter != headers.end(); iter++) {
-      headername = iter->first;
-      req_headers[headername] = iter->second;
+  // State of a DXHTTPRequest, across all attempts made for it. Used by both
+  // synchronous and asynchronous (see DXHTTPRequestAsync()) requests:
+  // startAttempt() prepares "req" for next attempt, and once it's made (or
+  // has failed with an HttpRequestException, see attemptFailed()),
+  // attemptDone() decides whether to retry.
+  // Note: We only consider 200 as a successful response, all others are considered "failures"
+  // The response is allocated from "arena" (or heap, if it's NULL), or read into "lazy" (if not NULL)
+  class DXHTTPRequestState {
+  public:
+    HttpRequest req;
 
-      transform(headername.begin(), headername.end(), headername.begin(), ::tolower);
-      if (headername == "content-type") {
-        content_type_set = true;
+    DXHTTPRequestState(const string &resource, const string &data_, const bool safeToRetry_, const map<string, string> &headers,
+                       JSONArena *arena, LazyJSONDocument *lazy)
+      : data(data_), safeToRetry(safeToRetry_), sink(arena, lazy), countTries(0u), sec_to_wait(2), retryAfterSeconds(60u) {
+      DXLOG(logDEBUG) << "In DXHTTPRequest(), inputs:" << endl
+                    << " --resources = '" << resource << "'" << endl
+                    << " --safeToRetry = " << safeToRetry << endl
+                    << " --data = '" << data.substr(0, 100) << "'" << endl
+                    << " --headers = '" << JSON(headers).toString() << "'";
+
+      if (config::APISERVER().empty()) {
+        throw DXError("dxcpp::DXHTTPRequest()-> API server information not found. Please set DX_APISERVER_HOST, DX_APISERVER_PORT, and DX_APISERVER_PROTOCOL.", "ApiserverInfoMissing");
       }
-    }
 
-    if (!content_type_set)
-      req_headers["Content-Type"] = "application/json; charset=utf-8";
+      const JSON &ctx = config::SECURITY_CONTEXT();
+      if (ctx.type() != JSON_HASH
+          || !ctx.has("auth_token_type") || ctx["auth_token_type"].type() != JSON_STRING
+          || !ctx.has("auth_token") || ctx["auth_token"].type() != JSON_STRING) {
+        if (ctx.type() != JSON_HASH || ctx.size() == 0) {
+          throw DXError("dxcpp::DXHTTPRequest()-> DX_SECURITY_CONTEXT is either not set, or not a valid JSON", "SecurityContextNotFound");
+        } else {
+          throw DXError("dxcpp::DXHTTPRequest()-> Invalid DX_SECURITY_CONTEXT string: '" + ctx.toString() + "'", "BadSecurityContextString");
+        }
+      }
 
-    // TODO: Load retry parameters (wait time, max number of retries, etc)
-    // from some config file
+      url = config::APISERVER() + resource;
+      req_headers["Authorization"] = ctx["auth_token_type"].get<string>() + " " + ctx["auth_token"].get<string>();
+      req_headers["DNAnexus-API"] = config::API_VERSION();
 
-    unsigned int countTries = 0u;
-    HttpRequest req;
-    unsigned int sec_to_wait = 2; // number of seconds to wait before retrying first time. Will keep on doubling the wait time for each subsequent retry.
-    bool reqCompleted; // did last request actually went through, i.e., some response was received)
-    bool contentLengthMismatch;
-    bool contentLengthMissing;
-    unsigned int retryAfterSeconds = 60u; // Number of seconds to retry after,
-                                          // in the event of a 503 response
-    HttpRequestException hre;
+      string headername;
 
-    // The HTTP Request is always executed at least once,
-    // a maximum of NUM_MAX_RETRIES number of subsequent tries are made, if required and feasible.
-    while (true) {
+      // TODO: Reconsider this; would we rather just set the content-type
+      // to json always?
+      bool content_type_set = false;
+      for (map<string, string>::const_iterator iter = headers.begin(); iter != headers.end(); iter++) {
+        headername = iter->first;
+        req_headers[headername] = iter->second;
 
+        transform(headername.begin(), headername.end(), headername.begin(), ::tolower);
+        if (headername == "content-type") {
+          content_type_set = true;
+        }
+      }
+
+      if (!content_type_set)
+        req_headers["Content-Type"] = "application/json; charset=utf-8";
+    }
+
+    void startAttempt() {
       // Variable "toRetry" indicates whether or not the request should be retried on failure
       // Note: Initial value of "false" is just a dummy value, toRetry will always be re-init before being used.
       //       This dummy initial value is provided, to prevent some spurious warnings from clang
-      bool toRetry = false;
+      toRetry = false;
       // True if the request returns with a 503
-      bool serviceUnavailable = false;
+      serviceUnavailable = false;
 
       reqCompleted = true; // will explicitly set it to false in case request couldn't be completed
-      try {
-        DXLOG(logDEBUG) << "Attempting the actual HTTP request (countTries = " << countTries << ")...";
-        // Attempt a POST request
-        req = HttpRequest::request(HTTP_POST, url, req_headers, data.data(), data.size());
-        DXLOG(logDEBUG) << "Request completed, responseCode = '" << req.responseCode << "'";
-      } catch (HttpRequestException &e) {
-        DXLOG(logDEBUG) << "HttpRequestException thrown ... message = '" << e.what() << "'";
-        // Retry the request in any of these three scenarios:
-        //
-        //  - safeToRetry is true
-        //  - errorCode returned by HttpRequestException is < 0 (implies that
-        //    the request was never made to the server)
-        //  - isAlwaysRetryableCurlError() - A list of curl codes, which are
-        //    *ALWAYS* safe to retry (irrespective of the request being made -
-        //    idempotent or not, etc).
-        toRetry = safeToRetry || (e.errorCode < 0) || isAlwaysRetryableCurlError(e.errorCode);
-        reqCompleted = false;
-        hre = e;
-      }
+      DXLOG(logDEBUG) << "Attempting the actual HTTP request (countTries = " << countTries << ")...";
+      // Attempt a POST request
+      req.clear();
+      req.buildRequest(HTTP_POST, url, req_headers, data.data(), data.size());
+      req.bodySink = &sink; // Successful responses are parsed as they arrive
+      req.multiplex = true; // API calls can share an HTTP/2 connection (see config::HTTP2())
+    }
+
+    void attemptFailed(const HttpRequestException &e) {
+      DXLOG(logDEBUG) << "HttpRequestException thrown ... message = '" << e.what() << "'";
+      // Retry the request in any of these three scenarios:
+      //
+      //  - safeToRetry is true
+      //  - errorCode returned by HttpRequestException is < 0 (implies that
+      //    the request was never made to the server)
+      //  - isAlwaysRetryableCurlError() - A list of curl codes, which are
+      //    *ALWAYS* safe to retry (irrespective of the request being made -
+      //    idempotent or not, etc).
+      toRetry = safeToRetry || (e.errorCode < 0) || isAlwaysRetryableCurlError(e.errorCode);
+      reqCompleted = false;
+      hre = e;
+    }
 
+    // Returns true if the request succeeded (response is stored in "out"), or
+    // false if it should be retried after waiting for "waitSeconds".
+    // Throws if the request failed, and is not to be retried.
+    bool attemptDone(JSON &out, unsigned int &waitSeconds) {
       if (reqCompleted) {
+        DXLOG(logDEBUG) << "Request completed, responseCode = '" << req.responseCode << "'";
         if (req.responseCode != 200) {
           DXLOG(logWARNING) << "POST '" << url << "' returned with HTTP code '" << req.responseCode << "'; and body: '" << req.respData << "'";
           toRetry = isAlwaysRetryableHttpCode(req.responseCode);
@@ -213,22 +284,22 @@ namespace dx {
         } else {
           // We are here => The request went thru, we got 200 and a response
           string clHeader; // content-length header
-          contentLengthMissing = !req.respHeader.getHeaderString("Content-Length", clHeader);
-          contentLengthMismatch = !contentLengthMissing && (boost::lexical_cast<size_t>(clHeader) != req.respData.size());
+          bool contentLengthMissing = !req.respHeader.getHeaderString("Content-Length", clHeader);
+          bool contentLengthMismatch = !contentLengthMissing && (boost::lexical_cast<size_t>(clHeader) != sink.size);
           if (contentLengthMismatch) {
             // This is an error situation for us, retry only if explicitly asked
             toRetry = safeToRetry;
             DXLOG(logWARNING) << "POST '" << url << "': Expected Content-Length to be '" << clHeader << "' (from Content-Length header)"
-                              << "but received " << req.respData.size() << ", retry = " << ((safeToRetry) ? "true" : "false");
+                              << "but received " << sink.size << ", retry = " << ((safeToRetry) ? "true" : "false");
           } else {
             try {
-              JSON out = JSON::parse(req.respData);
+              out = sink.finish();
               if (countTries != 0u) {
                 // if at least one retry was made, print eventual success on stderr
                 DXLOG(logWARNING) << "Request completed successfully in Retry #" << countTries;
               }
               DXLOG(logDEBUG) << "Exiting DXHTTPRequest() successfully";
-              return out;
+              return true;
             } catch (JSONException &je) {
               if (contentLengthMissing) {
                 DXLOG(logWARNING) << "POST '" << url << "': Unable to parse response from server as valid JSON, and no 'Content-Length' header was found either"
@@ -239,8 +310,8 @@ namespace dx {
                                 << clHeader << "). Will throw DXError()";
                 ostringstream errStr;
                 errStr << "\nERROR: Unable to parse output returned by Apiserver as JSON (and 'Content-length' header was present = " << clHeader << ")" << endl;
-                errStr << "HttpRequest url: " << url << "; response code: " << req.responseCode << "; response size: '" << req.respData.size()
-                       << "; response body: '" << req.respData.substr(0, 1000) << "'" << endl; // return at most 1000 characters from response (don't overwhelm user!)
+                errStr << "HttpRequest url: " << url << "; response code: " << req.responseCode << "; response size: '" << sink.size
+                       << "; response body: '" << sink.head << "'" << endl; // return at most 1000 characters from response (don't overwhelm user!)
                 errStr << "JSONException: '" << je.what() << "'" << endl;
                 throw DXError(errStr.str(), "UnableToParseAsJSON");
               }
@@ -250,20 +321,18 @@ namespace dx {
       }
 
       if (!toRetry || (countTries >= NUM_MAX_RETRIES)) {
-        // Code after this loop wants to know how many attempts were made, so
+        // Code below wants to know how many attempts were made, so
         // update to reflect the most recent attempt.
         countTries++;
-        break;
+        throwFailure();
       }
 
       // 503 with Retry-After-- do not count such responses against the allowed
       // number of retries
       if (serviceUnavailable) {
         DXLOG(logWARNING) << "Service unavailable, waiting for " << retryAfterSeconds << " seconds : POST '" << url << "'";
-        boost::this_thread::interruption_point();
-        _internal::sleepUsingNanosleep(retryAfterSeconds);
-        DXLOG(logDEBUG) << "Sleep finished, will recheck for service availability";
-        continue;
+        waitSeconds = retryAfterSeconds;
+        return false;
       }
 
       assert(countTries < NUM_MAX_RETRIES);
@@ -272,35 +341,191 @@ namespace dx {
         DXLOG(logWARNING) << "Unable to complete request: POST '" << url << "' (in retry #" << (countTries + 1) << "). Details: '" << hre.what() << "'";
       }
       DXLOG(logWARNING) << "Waiting ... " << sec_to_wait << " seconds before retry " << (countTries + 1) << " of " << NUM_MAX_RETRIES << " ...";
-      boost::this_thread::interruption_point();
-      _internal::sleepUsingNanosleep(sec_to_wait);
-      DXLOG(logDEBUG) << "Sleep finished, will go & retry the request";
+      waitSeconds = sec_to_wait;
 
       countTries++;
       sec_to_wait *= 2u;
+      return false;
     }
 
-    // We are here, implies, All retries were exhausted (or not attempted) with failure.
-    if (reqCompleted) {
-      DXLOG(logERROR) << "POST '" + url + "': failed after " << countTries << "' attempts. Response code: " << req.responseCode;
-      JSON respJSON;
+  private:
+    static const unsigned int NUM_MAX_RETRIES = 5u; // maximum number of retries for an individual request
+
+    // TODO: Load retry parameters (wait time, max number of retries, etc)
+    // from some config file
+
+    string url;
+    HttpHeaders req_headers;
+    const string &data;
+    const bool safeToRetry;
+    JSONResponseSink sink;
+
+    unsigned int countTries;
+    unsigned int sec_to_wait; // number of seconds to wait before retrying first time. Will keep on doubling the wait time for each subsequent retry.
+    bool reqCompleted; // did last request actually went through, i.e., some response was received)
+    bool toRetry;
+    bool serviceUnavailable;
+    unsigned int retryAfterSeconds; // Number of seconds to retry after,
+                                    // in the event of a 503 response
+    HttpRequestException hre;
+
+    // Called once all retries were exhausted (or not attempted) with failure.
+    void throwFailure() {
+      if (reqCompleted) {
+        DXLOG(logERROR) << "POST '" + url + "': failed after " << countTries << "' attempts. Response code: " << req.responseCode;
+        // Error response is only needed for constructing the exception
+        JSONArena errArena;
+        JSON respJSON;
+        try {
+          respJSON.readFromBuffer(req.respData.data(), req.respData.data() + req.respData.size(), errArena);
+        } catch (JSONException &e) {
+          // If invalid json, throw general DXError
+          throw DXError("Server's response code: '" + boost::lexical_cast<string>(req.responseCode) + "', response: '" + req.respData.substr(0,1000) + 
+                        "'. Could not parse response as valid JSON, error = '" + e.what() + "'", "UnableToParseAsJSON");
+        }
+        throw DXAPIError(respJSON["error"]["message"].get<string>(),
+                         respJSON["error"]["type"].get<string>(),
+                         req.responseCode);
+      } else {
+        DXLOG(logERROR) << "Unable to complete request: POST '" << url << "' in '" << countTries << "' attempts." << endl;
+        throw DXConnectionError("Was unable to make the request: POST '" + url + "' . Details: '" + hre.err + "'.", hre.errorCode);
+      }
+    }
+
+    DXHTTPRequestState(const DXHTTPRequestState &);
+    DXHTTPRequestState& operator=(const DXHTTPRequestState &);
+  };
+
+  static JSON DXHTTPRequestImpl(const string &resource, const string &data, const bool safeToRetry, const map<string, string> &headers,
+                                JSONArena *arena, LazyJSONDocument *lazy) {
+    DXHTTPRequestState state(resource, data, safeToRetry, headers, arena, lazy);
+
+    // The HTTP Request is always executed at least once,
+    // a maximum of NUM_MAX_RETRIES number of subsequent tries are made, if required and feasible.
+    while (true) {
+      state.startAttempt();
       try {
-        respJSON = JSON::parse(req.respData);
-      } catch (JSONException &e) {
-        // If invalid json, throw general DXError
-        throw DXError("Server's response code: '" + boost::lexical_cast<string>(req.responseCode) + "', response: '" + req.respData.substr(0,1000) + 
-                      "'. Could not parse response as valid JSON, error = '" + e.what() + "'", "UnableToParseAsJSON");
+        state.req.send();
+      } catch (HttpRequestException &e) {
+        state.attemptFailed(e);
       }
-      throw DXAPIError(respJSON["error"]["message"].get<string>(),
-                       respJSON["error"]["type"].get<string>(),
-                       req.responseCode);
-    } else {
-      DXLOG(logERROR) << "Unable to complete request: POST '" << url << "' in '" << countTries << "' attempts." << endl;
-      throw DXConnectionError("Was unable to make the request: POST '" + url + "' . Details: '" + hre.err + "'.", hre.errorCode);
+
+      JSON out;
+      unsigned int waitSeconds;
+      if (state.attemptDone(out, waitSeconds))
+        return out;
+
+      boost::this_thread::interruption_point();
+      _internal::sleepUsingNanosleep(waitSeconds);
+      DXLOG(logDEBUG) << "Sleep finished, will go & retry the request";
     }
     // Unreachable line
   }
 
+  JSON DXHTTPRequest(const string &resource, const string &data, const bool safeToRetry, const map<string, string> &headers) {
+    return DXHTTPRequestImpl(resource, data, safeToRetry, headers, NULL, NULL);
+  }
+
+  JSON DXHTTPRequest(const string &resource, const string &data, JSONArena &arena, const bool safeToRetry, const map<string, string> &headers) {
+    return DXHTTPRequestImpl(resource, data, safeToRetry, headers, &arena, NULL);
+  }
+
+  void DXHTTPRequest(const string &resource, const string &data, LazyJSONDocument &response, const bool safeToRetry, const map<string, string> &headers) {
+    DXHTTPRequestImpl(resource, data, safeToRetry, headers, NULL, &response);
+  }
+
+  // An asynchronous DXHTTPRequest: each attempt is made by HttpEventLoop, and
+  // retries are scheduled on it (instead of sleeping). Deletes itself once
+  // the request succeeds or fails.
+  class DXHTTPRequestAsyncOp {
+  public:
+    DXHTTPRequestAsyncOp(const string &resource, const string &data_, const bool safeToRetry, const map<string, string> &headers,
+                         const DXHTTPRequestCallback &done_)
+      : data(data_), state(resource, data, safeToRetry, headers, NULL, NULL), done(done_) {
+    }
+
+    // Resolved once the request is complete (unless a callback was provided)
+    std::future<JSON> future() {
+      return promise.get_future();
+    }
+
+    void attempt(unsigned int delaySeconds) {
+      state.startAttempt();
+      HttpEventLoop::submit(state.req, std::bind(&DXHTTPRequestAsyncOp::attemptComplete, this, std::placeholders::_2), delaySeconds);
+    }
+
+  private:
+    const string data; // Must outlive "state"
+    DXHTTPRequestState state;
+    DXHTTPRequestCallback done;
+    std::promise<JSON> promise;
+
+    // Called on the event loop thread
+    void attemptComplete(std::exception_ptr error) {
+      JSON out;
+      try {
+        if (error) {
+          try {
+            std::rethrow_exception(error);
+          } catch (HttpRequestException &e) {
+            state.attemptFailed(e);
+          }
+        }
+        unsigned int waitSeconds;
+        if (!state.attemptDone(out, waitSeconds)) {
+          DXLOG(logDEBUG) << "Will retry the request in " << waitSeconds << " seconds";
+          attempt(waitSeconds);
+          return;
+        }
+      } catch (...) {
+        finish(out, std::current_exception());
+        return;
+      }
+      finish(out, std::exception_ptr());
+    }
+
+    void finish(JSON &out, std::exception_ptr error) {
+      if (done) {
+        try {
+          done(out, error);
+        } catch (...) {
+          DXLOG(logERROR) << "Exception thrown by the completion callback of DXHTTPRequestAsync() was ignored";
+        }
+      } else if (error) {
+        promise.set_exception(error);
+      } else {
+        promise.set_value(std::move(out));
+      }
+      delete this;
+    }
+
+    DXHTTPRequestAsyncOp(const DXHTTPRequestAsyncOp &);
+    DXHTTPRequestAsyncOp& operator=(const DXHTTPRequestAsyncOp &);
+  };
+
+  void DXHTTPRequestAsync(const string &resource, const string &data, const bool safeToRetry, const map<string, string> &headers,
+                          const DXHTTPRequestCallback &done) {
+    DXHTTPRequestAsyncOp *op = new DXHTTPRequestAsyncOp(resource, data, safeToRetry, headers, done);
+    try {
+      op->attempt(0u);
+    } catch (...) {
+      delete op;
+      throw;
+    }
+  }
+
+  std::future<JSON> DXHTTPRequestAsync(const string &resource, const string &data, const bool safeToRetry, const map<string, string> &headers) {
+    DXHTTPRequestAsyncOp *op = new DXHTTPRequestAsyncOp(resource, data, safeToRetry, headers, DXHTTPRequestCallback());
+    std::future<JSON> result = op->future();
+    try {
+      op->attempt(0u);
+    } catch (...) {
+      delete op;
+      throw;
+    }
+    return result;
+  }
+
   // This sub-namespace contains loadFromEnvironment(), and several other helper functions/variables,
   // which are used for reading dxcpp configuration when the library is loaded
   // -> Configuration is read by a constructor of a global variable (so before main() is loaded)
@@ -363,15 +588,15 @@ namespace dx {
       }
       if (g_json_config_file_contents.type() == JSON_UNDEFINED) {
         // This is the first time this function is called, so parse the file, sanity check etc   
-        ifstream fp(fname, std::fstream::in);
-        if (!fp.is_open()) {
-          // file not found
-          g_json_config_file_contents = JSON(JSON_NULL);
-          return false;
-        }
+        MappedFile fp;
         try {
-          g_json_config_file_contents.read(fp);
-        } catch (JSONException &j) {
+          if (!fp.open(fname)) {
+            // file not found
+            g_json_config_file_contents = JSON(JSON_NULL);
+            return false;
+          }
+          g_json_config_file_contents = JSON::parse(fp.begin(), fp.end());
+        } catch (exception &j) { // JSONException, or an error while reading the file
           DXLOG(logWARNING) << "An error occured while trying to parse the JSON file '" << fname << "'. Will ignore contents of this file."
                << "Error = '" << j.what() << "'";
           g_json_config_file_contents = JSON(JSON_NULL); // don't attempt to parse file again
@@ -445,6 +670,23 @@ namespace dx {
         return string("'") + j.toString() + string("'");
       }
     }
+
+    // Reads a non-negative integer setting (if present) into "val". An invalid
+    // value is ignored (with a warning), and "val" keeps its default.
+    template<typename T>
+    void getIntegerFromEnvOrConfig(const string &key, T &val) {
+      string tmp;
+      if (!getFromEnvOrConfig(key, tmp))
+        return;
+      int64_t n = -1;
+      try {
+        n = boost::lexical_cast<int64_t>(tmp);
+      } catch (boost::bad_lexical_cast &) {}
+      if (n >= 0)
+        val = static_cast<T>(n);
+      else
+        DXLOG(logWARNING) << "Invalid value of '" << key << "': '" << tmp << "' (should be a non-negative integer). Will use the default value: " << val;
+    }
   
     // Returns a dummy value from this function (always true)
     void loadFromEnvironment() {
@@ -462,6 +704,9 @@ namespace dx {
       getFromEnvOrConfig("DX_APISERVER_PROTOCOL", APISERVER_PROTOCOL());
       getFromEnvOrConfig("DX_CA_CERT", CA_CERT());
       getFromEnvOrConfig("DX_LIBCURL_VERBOSE", LIBCURL_VERBOSE());
+      getFromEnvOrConfig("DX_HTTP2", HTTP2());
+      getIntegerFromEnvOrConfig("DX_HTTP_POOL_MAX_IDLE", HTTP_POOL_MAX_IDLE());
+      getIntegerFromEnvOrConfig("DX_HTTP_POOL_IDLE_TIMEOUT", HTTP_POOL_IDLE_TIMEOUT());
       getFromEnvOrConfig("DX_JOB_ID", JOB_ID());
       getFromEnvOrConfig("DX_WORKSPACE_ID", WORKSPACE_ID());
       getFromEnvOrConfig("DX_PROJECT_CONTEXT_ID", PROJECT_CONTEXT_ID());
@@ -501,6 +746,9 @@ namespace dx {
       DXLOG(logINFO) << "11. Current Project: " << getVariableForPrinting(CURRENT_PROJECT());
       DXLOG(logINFO) << "12. User Agent String: " << getVariableForPrinting(USER_AGENT_STRING());
       DXLOG(logINFO) << "13. Libcurl verbose: " << getVariableForPrinting(LIBCURL_VERBOSE());
+      DXLOG(logINFO) << "14. HTTP/2: " << getVariableForPrinting(HTTP2());
+      DXLOG(logINFO) << "15. HTTP pool max idle: " << HTTP_POOL_MAX_IDLE();
+      DXLOG(logINFO) << "16. HTTP pool idle timeout: " << HTTP_POOL_IDLE_TIMEOUT() << " seconds";
       DXLOG(logINFO) << "***** Will exit loadFromEnvironment() function in dxcpp.cc *****";
       
       g_config_file_contents_old.clear(); // Remove the contents of config file - we no longer need them
@@ -21,6 +21,9 @@
 #include <stdint.h>
 #include <map>
 #include <string>
+#include <exception>
+#include <functional>
+#include <future>
 #include "dxjson/dxjson.h"
 
 // A macro to allow unused variable (without throwing warning)
@@ -73,6 +76,76 @@ namespace dx {
   dx::JSON DXHTTPRequest(const std::string &resource, const std::string &data, const bool safeToRetry = false,
                          const std::map<std::string, std::string> &headers = std::map<std::string, std::string>());
 
+  /**
+   * Same as DXHTTPRequest() above, except that the response is parsed into
+   * the given arena (see dx::JSONArena). Useful for large responses which
+   * are only needed briefly: the returned value must be destroyed before
+   * the arena. This includes any value it is moved into, which still refers
+   * to the arena's storage (copy it, if it's needed for longer).
+   *
+   * @param resource API server route to access, e.g. "/file/new"
+   * @param data Data to send in the request
+   * @param arena The arena from which the response is allocated
+   * @param safeToRetry If true, indicates that the request is idempotent and that a failed request may be retried. Defaults to false.
+   * @param headers Additional HTTP headers to include in the request
+   * @return The response from the API server, parsed as a JSON
+   */
+  dx::JSON DXHTTPRequest(const std::string &resource, const std::string &data, dx::JSONArena &arena, const bool safeToRetry = false,
+                         const std::map<std::string, std::string> &headers = std::map<std::string, std::string>());
+
+  /**
+   * Same as DXHTTPRequest() above, except that the response is read into a
+   * dx::LazyJSONDocument: it's validated, but values are only converted when
+   * accessed. Useful when only a few fields of a large response are needed.
+   *
+   * @param resource API server route to access, e.g. "/file/new"
+   * @param data Data to send in the request
+   * @param response The response from the API server is read into this document
+   * @param safeToRetry If true, indicates that the request is idempotent and that a failed request may be retried. Defaults to false.
+   * @param headers Additional HTTP headers to include in the request
+   */
+  void DXHTTPRequest(const std::string &resource, const std::string &data, dx::LazyJSONDocument &response, const bool safeToRetry = false,
+                     const std::map<std::string, std::string> &headers = std::map<std::string, std::string>());
+
+  /**
+   * Called once an asynchronous request (see DXHTTPRequestAsync()) is
+   * complete: "error" is set to the exception DXHTTPRequest() would have
+   * thrown (if any), else "response" is the response from the API server.
+   * Called on the thread making the requests, so it must not block (but can
+   * make further asynchronous requests).
+   */
+  typedef std::function<void (const dx::JSON &response, std::exception_ptr error)> DXHTTPRequestCallback;
+
+  /**
+   * Asynchronous version of DXHTTPRequest(): returns immediately, and the
+   * request (including retries, which are made as DXHTTPRequest() would) is
+   * made by a single background thread, which can have any number of requests
+   * in flight (see dx::HttpEventLoop).
+   *
+   * @param resource API server route to access, e.g. "/file/new"
+   * @param data Data to send in the request
+   * @param safeToRetry If true, indicates that the request is idempotent and that a failed request may be retried. Defaults to false.
+   * @param headers Additional HTTP headers to include in the request
+   * @return A future, which is set to the response from the API server
+   *         (or to the exception DXHTTPRequest() would have thrown)
+   */
+  std::future<dx::JSON> DXHTTPRequestAsync(const std::string &resource, const std::string &data, const bool safeToRetry = false,
+                                           const std::map<std::string, std::string> &headers = std::map<std::string, std::string>());
+
+  /**
+   * Same as DXHTTPRequestAsync() above, except that "done" is called (on the
+   * background thread) once the request is complete, instead of a future
+   * being returned.
+   *
+   * @param resource API server route to access, e.g. "/file/new"
+   * @param data Data to send in the request
+   * @param safeToRetry If true, indicates that the request is idempotent and that a failed request may be retried.
+   * @param headers Additional HTTP headers to include in the request
+   * @param done Called once the request is complete
+   */
+  void DXHTTPRequestAsync(const std::string &resource, const std::string &data, const bool safeToRetry,
+                          const std::map<std::string, std::string> &headers, const DXHTTPRequestCallback &done);
+
   /**
    * Loads the data from environment variables and calls setAPIServerInfo(),
    * setSecurityContext(), setWorkspaceID(), and setProjectContext() as
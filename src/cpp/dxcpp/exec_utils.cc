@@ -18,13 +18,18 @@
 
 #include "exec_utils.h"
 #include "utils.h"
+#include "dxutil/mapped_file.h"
 
 using namespace std;
 
 namespace dx {
   void dxLoadInput(JSON &input) {
-    ifstream ifs(joinPath(getUserHomeDirectory(), "job_input.json"));
-    input.read(ifs);
+    input = JSON::parseFile(joinPath(getUserHomeDirectory(), "job_input.json"));
+  }
+
+  void dxLoadInput(JSONHandler &handler) {
+    MappedFile file(joinPath(getUserHomeDirectory(), "job_input.json"));
+    JSON::readEvents(file.begin(), file.end(), handler);
   }
 
   void dxWriteOutput(const JSON &output) {
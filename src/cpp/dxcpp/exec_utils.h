@@ -35,6 +35,16 @@ namespace dx {
    */
   void dxLoadInput(dx::JSON &input);
 
+  /**
+   * Same as dxLoadInput(dx::JSON&), except that the input is reported to
+   * the given handler as a stream of events (see dx::JSON::readEvents()),
+   * e.g., to start processing the elements of a large array of inputs while
+   * the rest of the file is still being read.
+   *
+   * @param handler Receives the input
+   */
+  void dxLoadInput(dx::JSONHandler &handler);
+
   /**
    * This function serializes the given JSON variable and saves it to
    * the local file job_output.json.
@@ -15,10 +15,18 @@
 //   under the License.
 
 #include "dxjson.h"
+#include "number_codec.h"
+#include "string_codec.h"
+#include "dxutil/mapped_file.h"
 #include <cstdio>
+#include <deque>
 
 using namespace dx;
 
+// See JSON::val for description of the layout
+static_assert(sizeof(JSON) == 16, "dx::JSON must be exactly 16 bytes");
+static_assert(offsetof(JSON, ext) == 8 && offsetof(JSON, len) == 14, "Unexpected layout of dx::JSON");
+
 /**
  * Determine the relative error when comparing two floating point values.
  */
@@ -28,6 +36,24 @@ double JSON::getEpsilon() {
   return json_epsilon;
 }
 
+/**
+ * If true, copies of arrays/objects share their storage (see JSON::setCopyOnWrite()).
+ * Atomic, since it may be changed while other threads copy values.
+ */
+static std::atomic<bool> json_copy_on_write(false);
+
+// Maximum nesting depth of arrays/objects accepted by all the readers (deeper
+// input is rejected, instead of overflowing the stack of recursive readers)
+static const size_t JSON_MAX_DEPTH = 1000;
+
+void JSON::setCopyOnWrite(bool enabled) {
+  json_copy_on_write = enabled;
+}
+
+bool JSON::getCopyOnWrite() {
+  return json_copy_on_write;
+}
+
 // TODO:
 // 1) Currently json strings are "escaped" only when using write() method, and stored as normal
 //    std::string. So if we use iterators like object_iterator for accessing all key in
@@ -53,67 +79,35 @@ namespace JSON_Utility
     return s.str();
   }
 
-  void SkipWhiteSpace(std::istream &in)
-  {
-    int c;
-    do
-    {
-      c = in.get();
-    } while ((c >= 0) && isspace(c));
-    if (c >= 0)
-      in.unget();
-  }
-
-  void WriteEscapedString(const std::string &s, std::ostream &out, bool enclosingQuotes = true)
-  {
-    if (enclosingQuotes)
-      out<<'"';
-
-    for (unsigned i = 0; i < s.length(); ++i)
-    {
-      if (s[i] >= 0x0000 && s[i] <= 0x001f)
-      {
-        // Control character case, should be escaped
-        // http://stackoverflow.com/questions/4901133/json-and-escaping-characters
-        char temphex[5] = {0};
-        switch(s[i]) {
-          case '\b':
-            out<<"\\b";
-            break;
-          case '\f':
-            out<<"\\f";
-            break;
-          case '\n':
-            out<<"\\n";
-            break;
-          case '\r':
-            out<<"\\r";
-            break;
-          case '\t':
-            out<<"\\t";
-            break;
-          default:
-            out<<"\\u";
-            sprintf(temphex, "%04x", s[i]);
-            out<<std::string(temphex);
-            break;
-        }
-      }
-      else {
-        switch(s[i]) {
-          case '"':
-            out<<"\\\"";
-            break;
-          case '\\':
-            out<<"\\\\";
-            break;
-          default:
-            out<<s[i];
+  // Appends the JSON string literal (enclosed in quotes) for [s, s + n) to "out".
+  // Runs of characters which need no escaping are copied as a whole.
+  void writeEscapedString(const char *s, size_t n, std::string &out) {
+    static const char hex[] = "0123456789abcdef";
+    const char *p = s, *end = s + n;
+    out += '"';
+    while (true) {
+      const char *q = findCharToEscape(p, end);
+      out.append(p, q - p);
+      if (q == end)
+        break;
+      switch (*q) {
+        case '"': out.append("\\\"", 2); break;
+        case '\\': out.append("\\\\", 2); break;
+        case '\b': out.append("\\b", 2); break;
+        case '\f': out.append("\\f", 2); break;
+        case '\n': out.append("\\n", 2); break;
+        case '\r': out.append("\\r", 2); break;
+        case '\t': out.append("\\t", 2); break;
+        default: {
+          // Any other control character (http://stackoverflow.com/questions/4901133/json-and-escaping-characters)
+          const char esc[6] = {'\\', 'u', '0', '0', hex[(*q >> 4) & 0xF], hex[*q & 0xF]};
+          out.append(esc, 6);
+          break;
         }
       }
+      p = q + 1;
     }
-    if (enclosingQuotes)
-      out<<'"';
+    out += '"';
   }
 
   // Returns true if "ch" represent start of a number token in JSON
@@ -143,350 +137,2226 @@ namespace JSON_Utility
     return (ch == '{');
   }
 
-  // This function is designed specifically for use from ReadNumberValue() only
-  // It assumes that string provided as *input* to the function is already in this form (regex):
-  //  [0-9-]{1,1}[-0-9+eE.]*
-  // It will then perform extra checks to find out if it corresponds to a valid JSON number or not
-  // Ref: http://www.json.org
-  //      http://jsonlint.com/
-  // Added later:
-  // Note: actually now this function does not assume input in any particular format
-  //       and finds out if any arbitrary json string is a valid number or not.
-  bool isValidJsonNumber(const std::string &s) {
-    unsigned len = s.length();
-    bool dot = false;
-    bool e = false;
-    if (len == 0)
-      return false;
-
-    unsigned start = (s[0] == '-') ? 1 : 0;
-    if (!isdigit(s[start]))
-      return false;
-
-    if (start + 1 == len)
-      return true;
+/*  std::string appendUTF8(uint32_t x) {
+    std::string temp_str = "";
+    //unsigned char tmp[5] = {0};
+    utf8::append(x, std::back_inserter(temp_str));
+    //return std::string(tmp);
+    return temp_str;
+  }*/
+  // See this function in utf8 namespace to fix invalid utf8 characters
+  // void fix_utf8_string(std::string& str);
 
-    if (s[start] == '0' && isdigit(s[start + 1]))
-      return false;
+  inline int32_t hexdigit_to_num(char ch) {
+    if (ch >= '0' && ch <= '9')
+      return uint32_t(ch - '0');
+    ch = toupper(ch);
+    if (ch >= 'A' && ch <= 'F')
+      return uint32_t(ch - 'A' + 10);
+    throw JSONException("Invalid Hex digit in unicode escape \\uxxxx: " + std::string(1,ch));
+  }
+
+  inline int32_t string4_to_hex(const char str[]) {
+    // We assume that str is always exactly 4 character long
+    return ( (hexdigit_to_num(str[0]) << 12) +
+             (hexdigit_to_num(str[1]) << 8)  +
+             (hexdigit_to_num(str[2]) << 4) +
+             (hexdigit_to_num(str[3])) );
+  }
 
-    for (unsigned i = start + 1; i < len; ++i) {
-      switch (s[i]) {
-        case '.':
-          if (e || dot)
-            return false;
-          dot = true;
+  // This function converts a json string (utf8) to a C++ string
+  // All escaped sequences are resolved and it is made sure that no invalid
+  // UTF-8 character is present in string after parsing (any invalid character
+  // is replaced with the replacement character: U+FFFFD)
+  // Care must be taken to not call it two times for a string inside an operation
+  // (for example, while using [] operator)
+
+  std::string parseUtf8JsonString(const char *inp, size_t inplength) {
+    std::string out;
+    out.reserve(inplength);
+
+    for (size_t i = 0; i < inplength; i++) {
+      if (inp[i] != '\\') {
+        // Copy the whole run of unescaped characters in one go
+        size_t runEnd = i + 1;
+        while (runEnd < inplength && inp[runEnd] != '\\')
+          ++runEnd;
+        out.append(inp + i, runEnd - i);
+        i = runEnd - 1;
+      }
+      else {
+        if ( (i + 1) >= inplength)
+          throw JSONException("Cannot end a string with \\ charcter");
+        i++;
+        int32_t first16bit, second16bit;
+        int32_t codepoint;
+        switch(inp[i]) {
+          case '"':  out += '"';   break;
+          case '\\': out += '\\'; break;
+          case '/':  out += '/';   break;
+          case 'b':  out += '\b';  break;
+          case 'f':  out += '\f';  break;
+          case 'n':  out += '\n';  break;
+          case 'r':  out += '\r';  break;
+          case 't':  out += '\t';  break;
+
+          case 'u':
+            if (i + 4 >= inplength)
+              throw JSONException("Expected exactly 4 hex digits after \\u");
+            first16bit = string4_to_hex(inp + i + 1);
+            i += 4;
+            codepoint = first16bit;
+            if (0xD800 <= first16bit && first16bit <= 0xDBFF) {
+              // Surrogate pair case
+              // Must have next 6 characters of the form: \uxxxx as well
+
+              if ( (i + 6) >= inplength || inp[i + 1] != '\\' || inp[i + 2] != 'u')
+                throw JSONException("Missing surrogate pair in unicode sequence");
+              i += 2;
+              second16bit = string4_to_hex(inp + i + 1);
+              i += 4;
+
+              if (0xDC00 <= second16bit && second16bit <= 0xDFFF) {
+                /* valid second surrogate */
+                codepoint = ((first16bit - 0xD800) << 10) + (second16bit - 0xDC00) + 0x10000;
+              }
+              else {
+                // Invalid second surrogate
+                throw JSONException("Invalid second 16 bit value in surrogate pair: first 16 bit = " + JSON_Utility::itos(first16bit) + " and second 16 bit = " + JSON_Utility::itos(second16bit));
+              }
+            }
+            try {
+              utf8::append(codepoint, back_inserter(out));
+            }
+            catch(utf8::invalid_code_point &e) {
+                throw JSONException("Invalid UTF-8 code point found in text. Value = " + itos(codepoint) + ". Location = " + std::string(inp, inplength) + "\nInternal message = " + e.what());
+            }
+            break;
+          default:
+            throw JSONException("Illegal escape sequence:" + std::string(1, inp[i]));
+        }
+      }
+    }
+    if (utf8::is_valid(out.begin(), out.end()))
+      return out;
+    return getValidatedUTF8String(out);
+  }
+
+  // Reference implementation of decodeString(), used for the strings which can not be
+  // handled by unescapeString() (i.e., strings with invalid UTF-8, or illegal escapes)
+  std::string decodeStringSlow(const char *start, const char *stop) {
+    if (memchr(start, '\\', stop - start) == NULL) {
+      std::string out(start, stop);
+      if (utf8::is_valid(out.begin(), out.end()))
+        return out;
+      return getValidatedUTF8String(out);
+    }
+    return parseUtf8JsonString(start, stop - start);
+  }
+
+  // Converts the raw characters of a json string (between the quotes) to a C++ string.
+  std::string decodeString(const char *start, const char *stop) {
+    std::string out(stop - start, '\0');
+    const size_t n = unescapeString(start, stop, &out[0]);
+    if (n == UNESCAPE_FAILED)
+      return decodeStringSlow(start, stop);
+    out.resize(n);
+    return out;
+  }
+
+  // Creates storage for an array/object, either on heap (arena == NULL), or in the arena
+  template<typename T>
+  T* newNode(JSONArena *arena) {
+    if (arena == NULL)
+      return new T();
+    return new (arena->allocate(sizeof(T), __alignof__(T))) T(arena);
+  }
+
+  // Returns out-of-line storage "node" of an array/object with the given tag, ready to be
+  // modified: if the storage is shared with other values (see JSON::setCopyOnWrite()), a
+  // copy of it (whose elements are copied the same way as by JSON's copy constructor)
+  // is returned instead, and the reference to the shared storage is released. If "leak"
+  // is true (a reference or iterator into the storage will be handed out), the storage is
+  // never shared again, since it could then be modified through that reference.
+  template<typename Node>
+  Node* unshare(Node *node, uint8_t tag, bool leak) {
+    if (tag & JSON::IN_ARENA)
+      return node; // Never shared
+    if (node->shared.refs.load(std::memory_order_acquire) > 1) {
+      Node *copy = new Node(*node);
+      if (node->shared.refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete node; // All the other values have released it in the meantime
+      node = copy;
+    }
+    if (leak)
+      node->shared.shareable = false;
+    return node;
+  }
+
+  // Returns elements of a JSON_ARRAY for modification (see unshare())
+  inline JSON::array_storage& mutableArray(JSON &j, bool leak) {
+    j.val.arr = unshare(j.val.arr, j.tag, leak);
+    return j.val.arr->val;
+  }
+
+  // Returns members of a JSON_OBJECT for modification (see unshare())
+  inline JSON::object_storage& mutableObject(JSON &j, bool leak) {
+    j.val.obj = unshare(j.val.obj, j.tag, leak);
+    return j.val.obj->val;
+  }
+
+  // Moves value of "src" to "dst" (which must be JSON_UNDEFINED), leaving "src" JSON_UNDEFINED
+  inline void relocate(JSON &dst, JSON &src) {
+    dst.val = src.val;
+    memcpy(dst.ext, src.ext, sizeof(dst.ext));
+    dst.len = src.len;
+    dst.tag = src.tag;
+    src.tag = JSON_UNDEFINED;
+  }
+
+  // Sets value of "j" (which must be JSON_UNDEFINED) to the string [s, s + n)
+  void setString(JSON &j, const char *s, size_t n, JSONArena *arena) {
+    if (n <= JSON::MAX_INLINE_STRING) {
+      memcpy(reinterpret_cast<char*>(&j), s, n);
+      j.len = static_cast<uint8_t>(n);
+      j.tag = JSON_STRING | JSON::STRING_INLINE;
+      return;
+    }
+    if (n > std::numeric_limits<uint32_t>::max())
+      throw JSONException("Strings longer than 4GB are not supported");
+    const uint32_t n32 = static_cast<uint32_t>(n);
+    j.val.str = (arena != NULL) ? static_cast<char*>(arena->allocate(n, 1)) : new char[n];
+    memcpy(j.val.str, s, n);
+    memcpy(j.ext, &n32, sizeof(n32));
+    j.tag = JSON_STRING | ((arena != NULL) ? JSON::IN_ARENA : 0);
+  }
+
+  // Sets value of "j" (which must be JSON_UNDEFINED) to the decoded json string, whose
+  // raw characters (between the quotes) are [start, stop). The string is decoded directly
+  // into it's final storage (decoded string is never longer than the raw one).
+  void setDecodedString(JSON &j, const char *start, const char *stop, JSONArena *arena) {
+    const size_t rawSize = stop - start;
+    if (rawSize <= JSON::MAX_INLINE_STRING) {
+      const size_t n = unescapeString(start, stop, reinterpret_cast<char*>(&j));
+      if (n != UNESCAPE_FAILED) {
+        j.len = static_cast<uint8_t>(n);
+        j.tag = JSON_STRING | JSON::STRING_INLINE;
+        return;
+      }
+    } else if (rawSize <= std::numeric_limits<uint32_t>::max()) {
+      char *dst = (arena != NULL) ? static_cast<char*>(arena->allocate(rawSize, 1)) : new char[rawSize];
+      const size_t n = unescapeString(start, stop, dst);
+      if (n != UNESCAPE_FAILED && n > JSON::MAX_INLINE_STRING) {
+        const uint32_t n32 = static_cast<uint32_t>(n);
+        j.val.str = dst;
+        memcpy(j.ext, &n32, sizeof(n32));
+        j.tag = JSON_STRING | ((arena != NULL) ? JSON::IN_ARENA : 0);
+        return;
+      }
+      if (n != UNESCAPE_FAILED)
+        setString(j, dst, n, NULL); // Short enough to be stored inline
+      if (arena == NULL)
+        delete [] dst;
+      if (n != UNESCAPE_FAILED)
+        return;
+    }
+    const std::string str = decodeStringSlow(start, stop);
+    setString(j, str.data(), str.size(), arena);
+  }
+
+  // Reads a number starting at "p" (and not going beyond "end"), and advances "p" past it.
+  void readNumber(const char *&p, const char *end, JSON &out) {
+    ParsedNumber num;
+    const char *last = parseNumber(p, end, num);
+    if (last == NULL) {
+      // Report all the characters which look like a part of number
+      const char *q = p;
+      while (q != end && ((*q >= '0' && *q <= '9') || *q == '+' || *q == '-' || *q == '.' || *q == 'e' || *q == 'E'))
+        ++q;
+      throw JSONException("Invalid JSON number: \"" + std::string(p, q) + "\". Unable to parse");
+    }
+    p = last;
+    if (num.isDouble) {
+      out.val.d = num.d;
+      out.tag = JSON_REAL;
+    } else {
+      out.val.i = num.i;
+      out.tag = JSON_INTEGER;
+    }
+  }
+
+  void readBoolean(const char *&p, const char *end, JSON &out) {
+    if (end - p >= 4 && memcmp(p, "true", 4) == 0) {
+      p += 4;
+      out.val.b = true;
+    } else if (end - p >= 5 && memcmp(p, "false", 5) == 0) {
+      p += 5;
+      out.val.b = false;
+    } else {
+      throw JSONException("Invalid Boolean value, expected exactly one of : 'true' or 'false'");
+    }
+    out.tag = JSON_BOOLEAN;
+  }
+
+  void readNull(const char *&p, const char *end, JSON &out) {
+    if (end - p < 4 || memcmp(p, "null", 4) != 0)
+      throw JSONException("Invalid JSON null, expected exactly: null");
+    p += 4;
+    out.tag = JSON_NULL;
+  }
+
+  // A tokenizer provides following operations to the parser (DOMReader):
+  //  - peek(): Returns next non-whitespace character (without consuming it), or -1 on EOF
+  //  - skip(): Consumes the character returned by last peek()
+  //  - readString(), readNumber(), readBoolean(), readNull(): Read the token starting at
+  //    the character returned by last peek()
+  //  - position(): Returns pointer to the first character not consumed yet
+
+  // Walks the contiguous buffer [p, end) one character at a time
+  class ScalarTokenizer {
+  public:
+    const char *p;
+    const char *end;
+
+    ScalarTokenizer(const char *begin, const char *end_): p(begin), end(end_) {}
+
+    int peek() {
+      while (p != end && isspace(static_cast<unsigned char>(*p)))
+        ++p;
+      return (p == end) ? -1 : static_cast<unsigned char>(*p);
+    }
+
+    void skip() { ++p; }
+
+    const char* position() const { return p; }
+
+    std::string readString() {
+      const char *start, *stop;
+      readRawString(start, stop);
+      return decodeString(start, stop);
+    }
+
+    void readString(JSON &out, JSONArena *arena) {
+      const char *start, *stop;
+      readRawString(start, stop);
+      setDecodedString(out, start, stop, arena);
+    }
+
+    void readNumber(JSON &out) { JSON_Utility::readNumber(p, end, out); }
+    void readBoolean(JSON &out) { JSON_Utility::readBoolean(p, end, out); }
+    void readNull(JSON &out) { JSON_Utility::readNull(p, end, out); }
+
+    // Consumes a string, and returns it's raw characters (between the quotes)
+    void readRawString(const char *&start, const char *&stop) {
+      assert(p != end && *p == '"'); // First character in a string should be quote
+      start = p + 1;
+      stop = findStringEnd(start, end);
+      if (stop == NULL)
+        throw JSONException("Unexpected EOF while reading string");
+      p = stop + 1;
+    }
+  };
+
+  // Moves elements of "pending" (starting at "first") into a new JSON_ARRAY
+  // (or members of "pendingMembers" into a new JSON_OBJECT) stored in "j"
+  void moveElements(JSON &j, std::deque<JSON> &pending, size_t first, JSONArena *arena) {
+    Array *a = newNode<Array>(arena);
+    j.val.arr = a;
+    j.tag = JSON_ARRAY | ((arena != NULL) ? JSON::IN_ARENA : 0);
+    a->val.resize(pending.size() - first);
+    for (size_t i = first; i < pending.size(); ++i)
+      relocate(a->val[i - first], pending[i]);
+    pending.resize(first);
+  }
+
+  // Called when an array/object is entered, "depth" is the new nesting depth
+  inline void checkDepth(size_t depth) {
+    if (depth > JSON_MAX_DEPTH)
+      throw JSONException("Arrays/objects are nested too deeply (maximum depth is " + boost::lexical_cast<std::string>(JSON_MAX_DEPTH) + ")");
+  }
+
+  struct MemberOrder {
+    std::deque<std::pair<std::string, JSON> >::iterator members;
+
+    explicit MemberOrder(std::deque<std::pair<std::string, JSON> >::iterator m): members(m) {}
+
+    bool operator()(uint32_t a, uint32_t b) const {
+      const int cmp = members[a].first.compare(members[b].first);
+      return (cmp != 0) ? (cmp < 0) : (a < b);
+    }
+  };
+
+  // Appends members [first, end) of "pendingMembers" to (empty) "o", sorted by key
+  void appendMembers(Object *o, std::deque<std::pair<std::string, JSON> > &pendingMembers, size_t first) {
+    const size_t n = pendingMembers.size() - first;
+    o->val.reserve(n);
+    std::deque<std::pair<std::string, JSON> >::iterator members = pendingMembers.begin() + first;
+    bool sorted = true;
+    for (size_t i = 1; i < n && sorted; ++i)
+      sorted = (members[i - 1].first < members[i].first);
+    if (sorted) {
+      for (size_t i = 0; i < n; ++i)
+        relocate(o->val.append(std::move(members[i].first)), members[i].second);
+    } else {
+      // Sort (indices of) the members by key, and then by position, so that
+      // only the last one of duplicate keys is kept (same as JSON::operator[])
+      std::vector<uint32_t> order(n);
+      for (size_t i = 0; i < n; ++i)
+        order[i] = static_cast<uint32_t>(i);
+      std::sort(order.begin(), order.end(), MemberOrder(members));
+      for (size_t k = 0; k < n; ++k) {
+        const size_t i = order[k];
+        if (k + 1 < n && members[order[k + 1]].first == members[i].first)
+          continue;
+        relocate(o->val.append(std::move(members[i].first)), members[i].second);
+      }
+    }
+    pendingMembers.resize(first);
+  }
+
+  void moveMembers(JSON &j, std::deque<std::pair<std::string, JSON> > &pendingMembers, size_t first, JSONArena *arena) {
+    Object *o = newNode<Object>(arena);
+    j.val.obj = o;
+    j.tag = JSON_OBJECT | ((arena != NULL) ? JSON::IN_ARENA : 0);
+    appendMembers(o, pendingMembers, first);
+  }
+
+  // Recursive descent parser, which builds the DOM from tokens returned by "Tokenizer"
+  // (allocating the strings, arrays, and objects from "arena", or from heap if it's NULL)
+  // Note: In case of an error, partially read value is left in the output JSON.
+  template<typename Tokenizer>
+  class DOMReader {
+  public:
+    Tokenizer &tok;
+    JSONArena *arena;
+
+    // Elements of arrays (and members of objects) being read (innermost array's
+    // elements are at the end). Storage of an array/object is only allocated once
+    // all of it's elements have been read.
+    // Note: std::deque never moves it's elements
+    std::deque<JSON> pending;
+    std::deque<std::pair<std::string, JSON> > pendingMembers;
+    size_t depth; // Number of arrays/objects enclosing the current value
+
+    DOMReader(Tokenizer &t, JSONArena *a): tok(t), arena(a), depth(0) {}
+
+    void readValue(JSON &j) {
+      j.clear();
+      int ch = tok.peek();
+      if (ch < 0)
+        throw JSONException("Unexpected EOF");
+
+      if (isObjectStart(ch))
+        readObject(j);
+      else if (isArrayStart(ch))
+        readArray(j);
+      else if (isStringStart(ch))
+        tok.readString(j, arena);
+      else if (isBooleanStart(ch))
+        tok.readBoolean(j);
+      else if (isNullStart(ch))
+        tok.readNull(j);
+      else if (isNumberStart(ch))
+        tok.readNumber(j);
+      else
+        throw JSONException("Illegal JSON value. Cannot start with : " + std::string(1, char(ch)));
+    }
+
+    void readObject(JSON &j) {
+      tok.skip(); // {
+      checkDepth(++depth);
+      const size_t first = pendingMembers.size();
+      bool firstKey = true;
+      do {
+        int ch = tok.peek();
+        if (ch < 0)
+          throw JSONException("Unexpected EOF while parsing object");
+
+        // End of parsing for this JSON object
+        if (ch == '}') {
+          tok.skip();
           break;
-        case 'e': // Desired fall through to next case statement ('E')
-        case 'E':
-          if (e)
-            return false;
-          e = true;
-          if (i + 1 >= len)
-            return false;
-          else {
-            if (s[i + 1] == '+' || s[i + 1] == '-') {
-              i++;
-              if (i + 1 >= len)
-                return false;
+        }
+
+        // Keys:value pairs must be separated by , inside JSON object
+        if (!firstKey) {
+          if (ch != ',')
+            throw JSONException("Expected , while parsing object. Got : " + std::string(1, char(ch)));
+          tok.skip();
+          ch = tok.peek();
+        }
+
+        if (!isStringStart(ch))
+          throw JSONException("Expected start of a valid object key (string) at this location");
+
+        pendingMembers.push_back(std::make_pair(tok.readString(), JSON()));
+        ch = tok.peek();
+        if (ch != ':')
+          throw JSONException("Expected :, got : " + std::string(1, char(ch)));
+        tok.skip();
+        readValue(pendingMembers.back().second);
+        firstKey = false;
+      } while (true);
+
+      --depth;
+      moveMembers(j, pendingMembers, first, arena);
+    }
+
+    void readArray(JSON &j) {
+      tok.skip(); // [
+      checkDepth(++depth);
+      const size_t first = pending.size();
+      bool firstKey = true;
+      do {
+        int ch = tok.peek();
+        if (ch < 0)
+          throw JSONException("Unexpected EOF while parsing array");
+
+        // End of parsing this array
+        if (ch == ']') {
+          tok.skip();
+          break;
+        }
+
+        if (!firstKey) {
+          if (ch != ',')
+            throw JSONException("Expected ,(comma) GOT: " + std::string(1, char(ch)));
+          tok.skip();
+        }
+
+        pending.push_back(JSON());
+        readValue(pending.back());
+        firstKey = false;
+      } while (true);
+
+      --depth;
+      moveElements(j, pending, first, arena);
+    }
+  };
+
+  // Reports the value read from "Tokenizer" to a JSONHandler (see JSON::readEvents()).
+  // Subtrees captured by the handler are read by a DOMReader sharing the same tokenizer.
+  template<typename Tokenizer>
+  class EventReader {
+  public:
+    Tokenizer &tok;
+    JSONHandler &handler;
+    DOMReader<Tokenizer> dom;
+    size_t depth; // Number of arrays/objects enclosing the current value
+
+    EventReader(Tokenizer &t, JSONHandler &h): tok(t), handler(h), dom(t, NULL), depth(0) {}
+
+    void readValue() {
+      int ch = tok.peek();
+      if (ch < 0)
+        throw JSONException("Unexpected EOF");
+
+      if (handler.captureValue(depth)) {
+        JSON j;
+        dom.depth = depth; // Limit applies to the whole document
+        dom.readValue(j);
+        handler.onValue(j);
+        return;
+      }
+
+      if (isObjectStart(ch))
+        readObject();
+      else if (isArrayStart(ch))
+        readArray();
+      else if (isStringStart(ch))
+        handler.onString(tok.readString());
+      else {
+        JSON j;
+        if (isBooleanStart(ch)) {
+          tok.readBoolean(j);
+          handler.onBoolean(j.val.b);
+        } else if (isNullStart(ch)) {
+          tok.readNull(j);
+          handler.onNull();
+        } else if (isNumberStart(ch)) {
+          tok.readNumber(j);
+          if (j.type() == JSON_INTEGER)
+            handler.onInt64(j.val.i);
+          else
+            handler.onDouble(j.val.d);
+        } else {
+          throw JSONException("Illegal JSON value. Cannot start with : " + std::string(1, char(ch)));
+        }
+      }
+    }
+
+    void readObject() {
+      tok.skip(); // {
+      handler.onStartObject();
+      checkDepth(++depth);
+      bool firstKey = true;
+      do {
+        int ch = tok.peek();
+        if (ch < 0)
+          throw JSONException("Unexpected EOF while parsing object");
+
+        if (ch == '}') {
+          tok.skip();
+          break;
+        }
+
+        if (!firstKey) {
+          if (ch != ',')
+            throw JSONException("Expected , while parsing object. Got : " + std::string(1, char(ch)));
+          tok.skip();
+          ch = tok.peek();
+        }
+
+        if (!isStringStart(ch))
+          throw JSONException("Expected start of a valid object key (string) at this location");
+
+        handler.onKey(tok.readString());
+        ch = tok.peek();
+        if (ch != ':')
+          throw JSONException("Expected :, got : " + std::string(1, char(ch)));
+        tok.skip();
+        readValue();
+        firstKey = false;
+      } while (true);
+      --depth;
+      handler.onEndObject();
+    }
+
+    void readArray() {
+      tok.skip(); // [
+      handler.onStartArray();
+      checkDepth(++depth);
+      bool firstKey = true;
+      do {
+        int ch = tok.peek();
+        if (ch < 0)
+          throw JSONException("Unexpected EOF while parsing array");
+
+        if (ch == ']') {
+          tok.skip();
+          break;
+        }
+
+        if (!firstKey) {
+          if (ch != ',')
+            throw JSONException("Expected ,(comma) GOT: " + std::string(1, char(ch)));
+          tok.skip();
+        }
+
+        readValue();
+        firstKey = false;
+      } while (true);
+      --depth;
+      handler.onEndArray();
+    }
+  };
+
+  // Validates the value read from "Tokenizer" (without building it), and records
+  // location of each array/object in it (used by LazyJSONDocument)
+  template<typename Tokenizer>
+  class LazyIndexer {
+  public:
+    Tokenizer &tok;
+    const char *buf;
+    std::vector<LazyJSONDocument::Container> &containers;
+    size_t depth; // Number of arrays/objects enclosing the current value
+
+    LazyIndexer(Tokenizer &t, const char *b, std::vector<LazyJSONDocument::Container> &c): tok(t), buf(b), containers(c), depth(0) {}
+
+    uint32_t offset() const { return static_cast<uint32_t>(tok.position() - buf); }
+
+    void readValue() {
+      int ch = tok.peek();
+      if (ch < 0)
+        throw JSONException("Unexpected EOF");
+
+      if (isObjectStart(ch) || isArrayStart(ch))
+        readContainer(ch);
+      else if (isStringStart(ch))
+        tok.readString();
+      else {
+        JSON j;
+        if (isBooleanStart(ch))
+          tok.readBoolean(j);
+        else if (isNullStart(ch))
+          tok.readNull(j);
+        else if (isNumberStart(ch))
+          tok.readNumber(j);
+        else
+          throw JSONException("Illegal JSON value. Cannot start with : " + std::string(1, char(ch)));
+      }
+    }
+
+    void readContainer(int open) {
+      const bool isObject = (open == '{');
+      const char close = isObject ? '}' : ']';
+      const size_t idx = containers.size();
+      LazyJSONDocument::Container c = {offset(), 0u, 0u};
+      containers.push_back(c);
+      tok.skip();
+      checkDepth(++depth);
+
+      uint32_t count = 0u;
+      do {
+        int ch = tok.peek();
+        if (ch < 0)
+          throw JSONException(isObject ? "Unexpected EOF while parsing object" : "Unexpected EOF while parsing array");
+
+        if (ch == close) {
+          tok.skip();
+          break;
+        }
+
+        if (count != 0u) {
+          if (ch != ',')
+            throw JSONException("Expected , while parsing " + std::string(isObject ? "object" : "array") + ". Got : " + std::string(1, char(ch)));
+          tok.skip();
+          ch = tok.peek();
+        }
+
+        if (isObject) {
+          if (!isStringStart(ch))
+            throw JSONException("Expected start of a valid object key (string) at this location");
+          tok.readString();
+          ch = tok.peek();
+          if (ch != ':')
+            throw JSONException("Expected :, got : " + std::string(1, char(ch)));
+          tok.skip();
+        }
+        readValue();
+        ++count;
+      } while (true);
+
+      --depth;
+      containers[idx].end = offset();
+      containers[idx].size = count;
+    }
+  };
+
+  // Following helpers walk a buffer which is already known to contain valid JSON
+  // (used by LazyJSON for skipping over values)
+
+  inline const char* skipWhitespace(const char *p) {
+    while (isspace(static_cast<unsigned char>(*p)))
+      ++p;
+    return p;
+  }
+
+  // "p" points to the opening quote; returns pointer past the closing quote
+  inline const char* skipString(const char *p) {
+    ++p;
+    while (*p != '"')
+      p += (*p == '\\') ? 2 : 1;
+    return p + 1;
+  }
+
+  // Builds a JSON value from events (used by PushParser). Same strategy as
+  // DOMReader: elements of arrays (and members of objects) are collected in
+  // "pending" (and "pendingMembers"), and only moved into (exactly sized)
+  // storage once the array/object ends.
+  class DOMBuilder: public JSONHandler {
+  public:
+    JSONArena *arena;
+    JSON root;
+    std::string key; // Last key read in the innermost object
+
+    struct Frame {
+      JSON *value;
+      bool isArray;
+      size_t first; // Index of first element of the array in "pending" (or member in "pendingMembers")
+    };
+    std::vector<Frame> stack; // Arrays/objects being read
+    std::deque<JSON> pending;
+    std::deque<std::pair<std::string, JSON> > pendingMembers;
+
+    explicit DOMBuilder(JSONArena *a): arena(a) {}
+
+    void reset() {
+      stack.clear();
+      pending.clear();
+      pendingMembers.clear();
+      root.clear();
+    }
+
+    // Returns the location for the next value
+    JSON& slot() {
+      if (stack.empty()) {
+        root.clear();
+        return root;
+      }
+      if (!stack.back().isArray) {
+        pendingMembers.push_back(std::make_pair(key, JSON()));
+        return pendingMembers.back().second;
+      }
+      pending.push_back(JSON());
+      return pending.back();
+    }
+
+    void push(JSON &j, bool isArray) {
+      Frame f;
+      f.value = &j;
+      f.isArray = isArray;
+      f.first = isArray ? pending.size() : pendingMembers.size();
+      stack.push_back(f);
+    }
+
+    void onStartObject() { push(slot(), false); }
+    void onKey(const std::string &k) { key = k; }
+
+    void onEndObject() {
+      const Frame f = stack.back();
+      stack.pop_back();
+      moveMembers(*f.value, pendingMembers, f.first, arena);
+    }
+
+    void onStartArray() { push(slot(), true); }
+
+    void onEndArray() {
+      const Frame f = stack.back();
+      stack.pop_back();
+      moveElements(*f.value, pending, f.first, arena);
+    }
+
+    void onString(const std::string &s) { setString(slot(), s.data(), s.size(), arena); }
+
+    void onInt64(int64_t x) {
+      JSON &j = slot();
+      j.val.i = x;
+      j.tag = JSON_INTEGER;
+    }
+
+    void onDouble(double x) {
+      JSON &j = slot();
+      j.val.d = x;
+      j.tag = JSON_REAL;
+    }
+
+    void onBoolean(bool x) {
+      JSON &j = slot();
+      j.val.b = x;
+      j.tag = JSON_BOOLEAN;
+    }
+
+    void onNull() { slot().tag = JSON_NULL; }
+  };
+
+  // Implementation of JSONPushParser: a state machine which consumes one
+  // token at a time. A token (string, number, or literal) which is split
+  // across fragments is accumulated in "partial" until it's complete.
+  class PushParser {
+  public:
+    enum Expect {
+      EXPECT_VALUE,
+      EXPECT_VALUE_OR_END, // First element of array
+      EXPECT_KEY,
+      EXPECT_KEY_OR_END, // First key of object
+      EXPECT_COLON,
+      EXPECT_COMMA_OR_END,
+      EXPECT_NOTHING // Top level value is complete
+    };
+
+    enum Token {
+      TOKEN_NONE,
+      TOKEN_STRING,
+      TOKEN_KEY,
+      TOKEN_NUMBER,
+      TOKEN_LITERAL
+    };
+
+    JSONHandler *handler; // NULL if a JSON object is being built (in "dom")
+    DOMBuilder dom;
+    size_t captureDepth; // Depth of the value captured (in "dom") for handler, or NONE
+    static const size_t NONE = static_cast<size_t>(-1);
+
+    std::string containers; // '[' or '{' for each array/object being read
+    Expect expect;
+    Token token;
+    std::string partial;
+    bool escaped; // Last character of a string token was an (unescaped) backslash
+    const char *literal; // "true", "false", or "null"
+    size_t literalPos; // Number of characters of literal matched so far
+    bool failed;
+    bool finished;
+
+    PushParser(JSONHandler *h, JSONArena *arena): handler(h), dom(arena) {
+      reset();
+    }
+
+    void reset() {
+      dom.reset();
+      captureDepth = NONE;
+      containers.clear();
+      expect = EXPECT_VALUE;
+      token = TOKEN_NONE;
+      partial.clear();
+      failed = finished = false;
+    }
+
+    JSONHandler& sink() {
+      return (handler == NULL || captureDepth != NONE) ? static_cast<JSONHandler&>(dom) : *handler;
+    }
+
+    void beginValue() {
+      if (handler != NULL && captureDepth == NONE && handler->captureValue(containers.size())) {
+        dom.reset();
+        captureDepth = containers.size();
+      }
+    }
+
+    void endValue() {
+      if (captureDepth == containers.size()) {
+        captureDepth = NONE;
+        handler->onValue(dom.root);
+      }
+      expect = containers.empty() ? EXPECT_NOTHING : EXPECT_COMMA_OR_END;
+    }
+
+    void endContainer() {
+      const char c = containers[containers.size() - 1];
+      containers.resize(containers.size() - 1);
+      if (c == '[')
+        sink().onEndArray();
+      else
+        sink().onEndObject();
+      endValue();
+    }
+
+    static bool isNumberCharacter(char ch) {
+      return (ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.' || ch == 'e' || ch == 'E';
+    }
+
+    void feed(const char *p, const char *end) {
+      if (failed)
+        throw JSONException("JSONPushParser: Cannot continue parsing after an error");
+      if (finished)
+        throw JSONException("JSONPushParser: finish() has already been called");
+      try {
+        while (p != end) {
+          if (token != TOKEN_NONE) {
+            p = continueToken(p, end);
+            continue;
+          }
+          const char ch = *p;
+          if (isspace(static_cast<unsigned char>(ch))) {
+            ++p;
+            continue;
+          }
+          switch (expect) {
+            case EXPECT_VALUE_OR_END:
+              if (ch == ']') {
+                ++p;
+                endContainer();
+                break;
+              }
+              // Fall through
+            case EXPECT_VALUE:
+              p = startValue(p);
+              break;
+            case EXPECT_KEY_OR_END:
+              if (ch == '}') {
+                ++p;
+                endContainer();
+                break;
+              }
+              // Fall through
+            case EXPECT_KEY:
+              if (!isStringStart(ch))
+                throw JSONException("Expected start of a valid object key (string) at this location");
+              ++p;
+              startToken(TOKEN_KEY);
+              break;
+            case EXPECT_COLON:
+              if (ch != ':')
+                throw JSONException("Expected :, got : " + std::string(1, ch));
+              ++p;
+              expect = EXPECT_VALUE;
+              break;
+            case EXPECT_COMMA_OR_END: {
+              const bool inArray = (containers[containers.size() - 1] == '[');
+              if (ch == ',') {
+                expect = inArray ? EXPECT_VALUE : EXPECT_KEY;
+              } else if (ch == (inArray ? ']' : '}')) {
+                endContainer();
+              } else if (inArray) {
+                throw JSONException("Expected ,(comma) GOT: " + std::string(1, ch));
+              } else {
+                throw JSONException("Expected , while parsing object. Got : " + std::string(1, ch));
+              }
+              ++p;
+              break;
             }
+            case EXPECT_NOTHING:
+              throw JSONException("Unexpected character after the end of JSON value: " + std::string(1, ch));
           }
+        }
+      } catch (...) {
+        failed = true;
+        throw;
+      }
+    }
+
+    void finish() {
+      if (failed)
+        throw JSONException("JSONPushParser: Cannot continue parsing after an error");
+      try {
+        if (token == TOKEN_NUMBER)
+          endNumber(NULL, NULL);
+        else if (token != TOKEN_NONE)
+          throw JSONException((token == TOKEN_LITERAL) ? "Unexpected EOF" : "Unexpected EOF while reading string");
+        if (expect != EXPECT_NOTHING) {
+          if (containers.empty())
+            throw JSONException("Unexpected EOF");
+          throw JSONException((containers[containers.size() - 1] == '[') ? "Unexpected EOF while parsing array" : "Unexpected EOF while parsing object");
+        }
+        finished = true;
+      } catch (...) {
+        failed = true;
+        throw;
+      }
+    }
+
+  private:
+    const char* startValue(const char *p) {
+      const char ch = *p;
+      beginValue();
+      if (isObjectStart(ch)) {
+        checkDepth(containers.size() + 1);
+        sink().onStartObject();
+        containers.push_back('{');
+        expect = EXPECT_KEY_OR_END;
+        return p + 1;
+      }
+      if (isArrayStart(ch)) {
+        checkDepth(containers.size() + 1);
+        sink().onStartArray();
+        containers.push_back('[');
+        expect = EXPECT_VALUE_OR_END;
+        return p + 1;
+      }
+      if (isStringStart(ch)) {
+        startToken(TOKEN_STRING);
+        return p + 1;
+      }
+      if (isNumberStart(ch)) {
+        startToken(TOKEN_NUMBER);
+        return p;
+      }
+      if (isBooleanStart(ch) || isNullStart(ch)) {
+        startToken(TOKEN_LITERAL);
+        literal = (ch == 't') ? "true" : ((ch == 'f') ? "false" : "null");
+        literalPos = 0;
+        return p;
+      }
+      throw JSONException("Illegal JSON value. Cannot start with : " + std::string(1, ch));
+    }
+
+    void startToken(Token t) {
+      token = t;
+      escaped = false;
+      partial.clear();
+    }
+
+    const char* continueToken(const char *p, const char *end) {
+      switch (token) {
+        case TOKEN_STRING:
+        case TOKEN_KEY: return continueString(p, end);
+        case TOKEN_NUMBER: return continueNumber(p, end);
+        default: return continueLiteral(p, end);
+      }
+    }
+
+    const char* continueString(const char *p, const char *end) {
+      const char *start = p;
+      while (p != end) {
+        if (escaped) {
+          escaped = false;
+          ++p;
+          continue;
+        }
+        while (p != end && *p != '"' && *p != '\\')
+          ++p;
+        if (p == end)
           break;
-        default:
-          if (!isdigit(s[i]))
-            return false;
+        if (*p == '\\') {
+          escaped = true;
+          ++p;
+          continue;
+        }
+        // Closing quote: decode directly from the input, if the whole string is in this fragment
+        std::string s;
+        if (partial.empty()) {
+          s = decodeString(start, p);
+        } else {
+          partial.append(start, p);
+          s = decodeString(partial.data(), partial.data() + partial.size());
+          partial.clear();
+        }
+        const Token t = token;
+        token = TOKEN_NONE;
+        if (t == TOKEN_KEY) {
+          sink().onKey(s);
+          expect = EXPECT_COLON;
+        } else {
+          sink().onString(s);
+          endValue();
+        }
+        return p + 1;
       }
+      partial.append(start, end);
+      return end;
     }
-    return true;
+
+    const char* continueNumber(const char *p, const char *end) {
+      const char *start = p;
+      while (p != end && isNumberCharacter(*p))
+        ++p;
+      if (p == end) {
+        partial.append(start, end);
+        return end;
+      }
+      endNumber(start, p);
+      return p;
+    }
+
+    // Reads the number token, whose last part is [start, stop)
+    void endNumber(const char *start, const char *stop) {
+      if (!partial.empty()) {
+        partial.append(start, stop);
+        start = partial.data();
+        stop = start + partial.size();
+      }
+      JSON num;
+      readNumber(start, stop, num);
+      partial.clear();
+      token = TOKEN_NONE;
+      if (num.type() == JSON_INTEGER)
+        sink().onInt64(num.val.i);
+      else
+        sink().onDouble(num.val.d);
+      endValue();
+    }
+
+    const char* continueLiteral(const char *p, const char *end) {
+      for (; p != end && literal[literalPos] != '\0'; ++p, ++literalPos) {
+        if (*p != literal[literalPos]) {
+          if (literal[0] == 'n')
+            throw JSONException("Invalid JSON null, expected exactly: null");
+          throw JSONException("Invalid Boolean value, expected exactly one of : 'true' or 'false'");
+        }
+      }
+      if (literal[literalPos] == '\0') {
+        token = TOKEN_NONE;
+        if (literal[0] == 'n')
+          sink().onNull();
+        else
+          sink().onBoolean(literal[0] == 't');
+        endValue();
+      }
+      return p;
+    }
+  };
+
+  // Implementation of JSON::readFromBuffer() (values are allocated from heap if arena is NULL)
+  const char* readFromBuffer(JSON &j, const char *begin, const char *end, JSONArena *arena);
+}
+
+namespace JSON_Utility {
+  // Appends serialized "j" to "out" (see JSON::writeTo())
+  void writeValue(const JSON &j, std::string &out) {
+    switch (j.type()) {
+      case JSON_INTEGER: {
+        char buf[MAX_NUMBER_LENGTH];
+        out.append(buf, formatInteger(j.val.i, buf));
+        break;
+      }
+      case JSON_REAL: {
+        char buf[MAX_NUMBER_LENGTH];
+        assertValidityOfNumericType(j.val.d);
+        out.append(buf, formatDouble(j.val.d, buf));
+        break;
+      }
+      case JSON_BOOLEAN:
+        if (j.val.b)
+          out.append("true", 4);
+        else
+          out.append("false", 5);
+        break;
+      case JSON_NULL: out.append("null", 4); break;
+      case JSON_STRING: writeEscapedString(j.stringData(), j.stringSize(), out); break;
+      case JSON_ARRAY: {
+        const JSON::array_storage &arr = j.val.arr->val;
+        out += '[';
+        for (size_t i = 0; i < arr.size(); ++i) {
+          if (i != 0)
+            out += ',';
+          writeValue(arr[i], out);
+        }
+        out += ']';
+        break;
+      }
+      case JSON_OBJECT: {
+        const JSON::object_storage &obj = j.val.obj->val;
+        out += '{';
+        for (JSON::object_storage::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+          if (it != obj.begin())
+            out += ',';
+          writeEscapedString(it->first.data(), it->first.size(), out);
+          out += ':';
+          writeValue(it->second, out);
+        }
+        out += '}';
+        break;
+      }
+      default:
+        throw JSONException("Cannot call write() method on uninitialized json object");
+    }
+  }
+
+  // Comparison of two JSON_REAL values (see JSON::getEpsilon())
+  bool isEqualReal(double a, double b) {
+    //Ref: 1. http://floating-point-gui.de/errors/comparison/
+    //     2. http://randomascii.wordpress.com/2012/02/25/comparing-floating-point-numbers-2012-edition/
+    double diff = fabs(a - b);
+    double eps = JSON::getEpsilon();
+
+    // If numbers are really close (absolute error), return true
+    // needed for numbers near zero
+    if (diff <= eps) {
+      return true;
+    }
+    // Now use absolute error to check for "closeness"
+    double absA = fabs(a);
+    double absB = fabs(b);
+    double largest = (absA > absB) ? absA : absB;
+    // always use largest to check for relative error
+    // so that isEqual() remain commutative
+    return diff <= (largest * eps);
+  }
+}
+
+void JSON::write(std::ostream &out) const {
+  if (this->type() == JSON_UNDEFINED) {
+    throw JSONException("Cannot call write() method on uninitialized json object");
+  }
+  std::string buf;
+  writeTo(buf);
+  out.write(buf.data(), buf.size());
+  out.flush();
+}
+
+void JSON::writeTo(std::string &out) const {
+  if (this->type() == JSON_UNDEFINED) {
+    throw JSONException("Cannot call write() method on uninitialized json object");
   }
-  Value* ReadNumberValue(std::istream &in) {
-    Value *toReturn = NULL;
-    std::string toParse = "";
-    int ch;
-    bool isDouble = false; // By default the number is integer, unless set otherwise
-    do {
-      ch = in.get();
-      if (in.eof())
+  JSON_Utility::writeValue(*this, out);
+}
+
+void JSON::writeString(const std::string &s, std::string &out) {
+  JSON_Utility::writeEscapedString(s.data(), s.size(), out);
+}
+
+void JSON::readFromString(const std::string &jstr) {
+  readFromBuffer(jstr.data(), jstr.data() + jstr.size());
+}
+
+const char* JSON::readFromBuffer(const char *begin, const char *end) {
+  return JSON_Utility::readFromBuffer(*this, begin, end, NULL);
+}
+
+const char* JSON::readFromBuffer(const char *begin, const char *end, JSONArena &arena) {
+  return JSON_Utility::readFromBuffer(*this, begin, end, &arena);
+}
+
+const char* JSON_Utility::readFromBuffer(JSON &j, const char *begin, const char *end, JSONArena *arena) {
+  try {
+    ScalarTokenizer tok(begin, end);
+    DOMReader<ScalarTokenizer>(tok, arena).readValue(j);
+    return tok.position();
+  } catch (...) {
+    j.clear(); // Do not leave a partially read value behind
+    throw;
+  }
+}
+
+namespace JSON_Utility {
+  // Major types of CBOR (RFC 7049) data items, used by JSON::writeBinary()/readBinary()
+  enum {
+    CBOR_UNSIGNED = 0,
+    CBOR_NEGATIVE = 1,
+    CBOR_BYTES = 2,
+    CBOR_TEXT = 3,
+    CBOR_ARRAY = 4,
+    CBOR_MAP = 5,
+    CBOR_TAG = 6,
+    CBOR_SIMPLE = 7 // Also floats
+  };
+
+  // Simple values (major type 7), and the "additional information" values
+  // for floats and indefinite length items
+  enum {
+    CBOR_FALSE = 20,
+    CBOR_TRUE = 21,
+    CBOR_NULL = 22,
+    CBOR_FLOAT16 = 25,
+    CBOR_FLOAT32 = 26,
+    CBOR_FLOAT64 = 27,
+    CBOR_INDEFINITE = 31
+  };
+
+  // Appends the initial byte of a data item of the given major type, with argument
+  // "arg" (integer value, or length), using the shortest form
+  void writeCBORHead(unsigned major, uint64_t arg, std::string &out) {
+    char buf[9];
+    buf[0] = static_cast<char>(major << 5);
+    if (arg < 24) {
+      buf[0] |= static_cast<char>(arg);
+      out += buf[0];
+      return;
+    }
+    size_t n;
+    if (arg <= 0xFF) {
+      buf[0] |= 24;
+      n = 1;
+    } else if (arg <= 0xFFFF) {
+      buf[0] |= 25;
+      n = 2;
+    } else if (arg <= 0xFFFFFFFFull) {
+      buf[0] |= 26;
+      n = 4;
+    } else {
+      buf[0] |= 27;
+      n = 8;
+    }
+    for (size_t i = 0; i < n; ++i)
+      buf[1 + i] = static_cast<char>(arg >> (8 * (n - 1 - i)));
+    out.append(buf, n + 1);
+  }
+
+  // Appends binary encoded "j" to "out" (see JSON::writeBinary())
+  void writeBinaryValue(const JSON &j, std::string &out) {
+    switch (j.type()) {
+      case JSON_INTEGER:
+        if (j.val.i >= 0)
+          writeCBORHead(CBOR_UNSIGNED, static_cast<uint64_t>(j.val.i), out);
+        else
+          writeCBORHead(CBOR_NEGATIVE, static_cast<uint64_t>(-1 - j.val.i), out);
+        break;
+      case JSON_REAL: {
+        uint64_t bits;
+        memcpy(&bits, &j.val.d, sizeof(bits));
+        char buf[9];
+        buf[0] = static_cast<char>((CBOR_SIMPLE << 5) | CBOR_FLOAT64);
+        for (size_t i = 0; i < 8; ++i)
+          buf[1 + i] = static_cast<char>(bits >> (8 * (7 - i)));
+        out.append(buf, 9);
+        break;
+      }
+      case JSON_BOOLEAN: out += static_cast<char>((CBOR_SIMPLE << 5) | (j.val.b ? CBOR_TRUE : CBOR_FALSE)); break;
+      case JSON_NULL: out += static_cast<char>((CBOR_SIMPLE << 5) | CBOR_NULL); break;
+      case JSON_STRING:
+        writeCBORHead(CBOR_TEXT, j.stringSize(), out);
+        out.append(j.stringData(), j.stringSize());
+        break;
+      case JSON_ARRAY: {
+        const JSON::array_storage &arr = j.val.arr->val;
+        writeCBORHead(CBOR_ARRAY, arr.size(), out);
+        for (size_t i = 0; i < arr.size(); ++i)
+          writeBinaryValue(arr[i], out);
         break;
+      }
+      case JSON_OBJECT: {
+        const JSON::object_storage &obj = j.val.obj->val;
+        writeCBORHead(CBOR_MAP, obj.size(), out);
+        for (JSON::object_storage::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+          writeCBORHead(CBOR_TEXT, it->first.size(), out);
+          out.append(it->first);
+          writeBinaryValue(it->second, out);
+        }
+        break;
+      }
+      default:
+        throw JSONException("Cannot call writeBinary() method on uninitialized json object");
+    }
+  }
 
-      // For time being allow all ., -, +,digit,e,E, as valid characters
-      // Then use isValidJsonNumber() to test validity more strictly
-      if (isdigit(ch) || ch == '+' || ch == '-') // All integer characters
-        toParse += ch;
-      else {
-        if (ch == '.' || ch == 'e' || ch == 'E') { // All floating point characters
-          isDouble = true;
-          toParse += ch;
+  // Decoder of the binary encoding (see JSON::readBinary()). Lengths of arrays, objects
+  // and strings are known upfront, so their storage is allocated once, with exact size
+  // (lengths are checked against the remaining input, so that a corrupted length can
+  // not trigger a huge allocation).
+  // Note: In case of an error, partially read value is left in the output JSON.
+  class BinaryReader {
+  public:
+    const unsigned char *p, *end;
+    JSONArena *arena;
+    // Members of objects being read (see DOMReader), only used for maps with keys out of order
+    std::deque<std::pair<std::string, JSON> > pendingMembers;
+    size_t depth; // Number of arrays/objects enclosing the current value
+
+    BinaryReader(const char *begin, const char *end_, JSONArena *arena_):
+      p(reinterpret_cast<const unsigned char*>(begin)),
+      end(reinterpret_cast<const unsigned char*>(end_)),
+      arena(arena_), depth(0) {}
+
+    const char* position() const { return reinterpret_cast<const char*>(p); }
+
+    void readValue(JSON &j) {
+      j.clear();
+      unsigned major, info;
+      uint64_t arg;
+      // Tags (e.g., the "self-described CBOR" tag) do not change the value, and are skipped
+      do {
+        major = head() >> 5;
+        info = *p++ & 31;
+        if (major == CBOR_SIMPLE) {
+          readSimple(j, info);
+          return;
         }
-        else // If none of these valid characters, then input is over. Push last character back
-        {
-          in.unget();
+        arg = argument(info);
+      } while (major == CBOR_TAG);
+      switch (major) {
+        case CBOR_UNSIGNED:
+        case CBOR_NEGATIVE:
+          if (arg > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+            throw JSONException("Binary json: integer out of range of int64");
+          j.val.i = (major == CBOR_UNSIGNED) ? static_cast<int64_t>(arg) : -1 - static_cast<int64_t>(arg);
+          j.tag = JSON_INTEGER;
           break;
+        case CBOR_TEXT: {
+          const char *s = take(arg);
+          if (utf8::is_valid(s, s + arg)) {
+            setString(j, s, arg, arena);
+          } else {
+            const std::string fixed = getValidatedUTF8String(std::string(s, arg));
+            setString(j, fixed.data(), fixed.size(), arena);
+          }
+          break;
+        }
+        case CBOR_ARRAY: {
+          checkLength(arg);
+          checkDepth(++depth);
+          Array *a = newNode<Array>(arena);
+          j.val.arr = a;
+          j.tag = JSON_ARRAY | ((arena != NULL) ? JSON::IN_ARENA : 0);
+          a->val.resize(arg);
+          for (uint64_t i = 0; i < arg; ++i)
+            readValue(a->val[i]);
+          --depth;
+          break;
+        }
+        case CBOR_MAP:
+          // Each member takes at least two bytes (key and value)
+          if (arg > static_cast<uint64_t>(end - p) / 2)
+            throw JSONException("Binary json: unexpected end of input");
+          checkDepth(++depth);
+          readMap(j, static_cast<size_t>(arg));
+          --depth;
+          break;
+        case CBOR_BYTES:
+          throw JSONException("Binary json: byte strings are not supported");
+      }
+    }
+
+  private:
+    // Returns the initial byte of the next data item (without consuming it)
+    unsigned head() const {
+      if (p == end)
+        throw JSONException("Binary json: unexpected end of input");
+      return *p;
+    }
+
+    // Consumes n bytes, returning pointer to the first one
+    const char* take(uint64_t n) {
+      if (n > static_cast<uint64_t>(end - p))
+        throw JSONException("Binary json: unexpected end of input");
+      const char *s = reinterpret_cast<const char*>(p);
+      p += n;
+      return s;
+    }
+
+    void readMap(JSON &j, size_t n) {
+      Object *o = newNode<Object>(arena);
+      j.val.obj = o;
+      j.tag = JSON_OBJECT | ((arena != NULL) ? JSON::IN_ARENA : 0);
+      o->val.reserve(n);
+      for (size_t i = 0; i < n; ++i) {
+        std::string key;
+        readKey(key);
+        if (!o->val.empty() && !(o->val.rbegin()->first < key)) {
+          // Out of order (not written by writeBinary()): collect all the members,
+          // and sort them at once (the last one of duplicate keys is kept)
+          const size_t first = pendingMembers.size();
+          for (JSON::object_storage::iterator it = o->val.begin(); it != o->val.end(); ++it) {
+            pendingMembers.push_back(std::make_pair(it->first, JSON()));
+            relocate(pendingMembers.back().second, it->second);
+          }
+          o->val.clear();
+          pendingMembers.push_back(std::make_pair(std::move(key), JSON()));
+          readValue(pendingMembers.back().second);
+          for (++i; i < n; ++i) {
+            pendingMembers.push_back(std::make_pair(std::string(), JSON()));
+            readKey(pendingMembers.back().first);
+            readValue(pendingMembers.back().second);
+          }
+          appendMembers(o, pendingMembers, first);
+          return;
         }
+        // Members written by writeBinary() are always in order
+        readValue(o->val.append(std::move(key)));
+      }
+    }
+
+    // Each of n data items takes at least one byte
+    void checkLength(uint64_t n) const {
+      if (n > static_cast<uint64_t>(end - p))
+        throw JSONException("Binary json: unexpected end of input");
+    }
+
+    uint64_t readUint(size_t n) {
+      const unsigned char *s = reinterpret_cast<const unsigned char*>(take(n));
+      uint64_t x = 0;
+      for (size_t i = 0; i < n; ++i)
+        x = (x << 8) | s[i];
+      return x;
+    }
+
+    // Reads the argument (integer value, or length) of a data item (other than major type 7)
+    uint64_t argument(unsigned info) {
+      if (info < 24)
+        return info;
+      switch (info) {
+        case 24: return readUint(1);
+        case 25: return readUint(2);
+        case 26: return readUint(4);
+        case 27: return readUint(8);
+        case CBOR_INDEFINITE: throw JSONException("Binary json: indefinite length items are not supported");
+        default: throw JSONException("Binary json: invalid initial byte " + itos((CBOR_SIMPLE << 5) | info));
       }
-    } while (true);
+    }
 
-    // Validate number now
-    // TODO: Rather than parsing string again add logic of isValidJsonNumber() to the
-    //       above do-while loop itself. : Slight optimization.
-    if (!isValidJsonNumber(toParse))
-      throw JSONException("Invalid JSON number: \"" + toParse + "\". Unable to parse");
+    void readSimple(JSON &j, unsigned info) {
+      double d;
+      switch (info) {
+        case CBOR_FALSE:
+        case CBOR_TRUE:
+          j.val.b = (info == CBOR_TRUE);
+          j.tag = JSON_BOOLEAN;
+          return;
+        case CBOR_NULL:
+          j.tag = JSON_NULL;
+          return;
+        case CBOR_FLOAT16: {
+          // IEEE 754 half precision (RFC 7049, appendix D)
+          const unsigned h = static_cast<unsigned>(readUint(2));
+          const unsigned exp = (h >> 10) & 0x1F, mant = h & 0x3FF;
+          if (exp == 0)
+            d = ldexp(static_cast<double>(mant), -24);
+          else if (exp != 31)
+            d = ldexp(static_cast<double>(mant + 1024), exp - 25);
+          else
+            d = std::numeric_limits<double>::infinity(); // Rejected below
+          if (h & 0x8000)
+            d = -d;
+          break;
+        }
+        case CBOR_FLOAT32: {
+          const uint32_t bits = static_cast<uint32_t>(readUint(4));
+          float f;
+          memcpy(&f, &bits, sizeof(f));
+          d = f;
+          break;
+        }
+        case CBOR_FLOAT64: {
+          const uint64_t bits = readUint(8);
+          memcpy(&d, &bits, sizeof(d));
+          break;
+        }
+        default:
+          throw JSONException("Binary json: unsupported simple value " + itos(info));
+      }
+      if (boost::math::isnan(d) || !boost::math::isfinite(d))
+        throw JSONException("Binary json: NaN and Infinity are not allowed in json");
+      j.val.d = d;
+      j.tag = JSON_REAL;
+    }
 
-    std::stringstream stream(toParse);
-    if (isDouble) {
-      Real *r = new Real();
-      stream>>r->val;
-      toReturn = dynamic_cast<Value*>(r);
+    void readKey(std::string &key) {
+      const unsigned major = head() >> 5, info = *p++ & 31;
+      if (major != CBOR_TEXT)
+        throw JSONException("Binary json: keys of objects must be text strings");
+      const uint64_t n = argument(info);
+      const char *s = take(n);
+      key.assign(s, n);
+      if (!utf8::is_valid(key.begin(), key.end()))
+        key = getValidatedUTF8String(key);
     }
-    else {
-      Integer *i = new Integer();
-      stream>>i->val;
-      toReturn = dynamic_cast<Value*>(i);
+  };
+
+  // Implementation of JSON::readBinary() (values are allocated from heap if arena is NULL)
+  const char* readBinary(JSON &j, const char *begin, const char *end, JSONArena *arena) {
+    try {
+      BinaryReader reader(begin, end, arena);
+      reader.readValue(j);
+      return reader.position();
+    } catch (...) {
+      j.clear(); // Do not leave a partially read value behind
+      throw;
     }
-    assert(toReturn != NULL); // To check that dynamic_cast was succesful
-    return toReturn;
   }
+}
 
-  void ReadJSONValue(std::istream &in, JSON &j, bool topLevel = false) {
-    j.clear();
-    JSON_Utility::SkipWhiteSpace(in);
+void JSON::writeBinary(std::string &out) const {
+  JSON_Utility::writeBinaryValue(*this, out);
+}
 
-    if (in.eof())
-      throw JSONException("Unexpected EOF");
+const char* JSON::readBinary(const char *begin, const char *end) {
+  return JSON_Utility::readBinary(*this, begin, end, NULL);
+}
+
+const char* JSON::readBinary(const char *begin, const char *end, JSONArena &arena) {
+  return JSON_Utility::readBinary(*this, begin, end, &arena);
+}
+
+JSONPushParser::JSONPushParser(): impl(new JSON_Utility::PushParser(NULL, NULL)) {}
+
+JSONPushParser::JSONPushParser(JSONArena &arena): impl(new JSON_Utility::PushParser(NULL, &arena)) {}
+
+JSONPushParser::JSONPushParser(JSONHandler &handler): impl(new JSON_Utility::PushParser(&handler, NULL)) {}
+
+JSONPushParser::~JSONPushParser() {
+  delete impl;
+}
 
-    int ch = in.get();
-    in.unget();
-    if (isObjectStart(ch))
-      j.val = new Object();
+void JSONPushParser::feed(const char *data, size_t len) {
+  impl->feed(data, data + len);
+}
+
+void JSONPushParser::finish() {
+  impl->finish();
+}
+
+bool JSONPushParser::isFinished() const {
+  return impl->finished;
+}
+
+JSON& JSONPushParser::value() {
+  if (!impl->finished || impl->handler != NULL)
+    throw JSONException("JSONPushParser::value() can only be called after finish(), and if no handler was provided");
+  return impl->dom.root;
+}
+
+void JSONPushParser::reset() {
+  impl->reset();
+}
+
+const char* JSON::readEvents(const char *begin, const char *end, JSONHandler &handler) {
+  JSON_Utility::ScalarTokenizer tok(begin, end);
+  JSON_Utility::EventReader<JSON_Utility::ScalarTokenizer>(tok, handler).readValue();
+  return tok.position();
+}
+
+void LazyJSONDocument::read(std::string &&str) {
+  if (str.size() > std::numeric_limits<uint32_t>::max())
+    throw JSONException("LazyJSONDocument: Values larger than 4GB are not supported");
+  buf.clear();
+  containers.clear();
+  rootPos = 0;
+  try {
+    const char *begin = str.data(), *end = str.data() + str.size();
+    JSON_Utility::ScalarTokenizer tok(begin, end);
+    tok.peek(); // Skips the leading whitespace
+    rootPos = static_cast<uint32_t>(tok.position() - begin);
+    JSON_Utility::LazyIndexer<JSON_Utility::ScalarTokenizer>(tok, begin, containers).readValue();
+  } catch (...) {
+    containers.clear();
+    rootPos = 0;
+    throw;
+  }
+  buf.swap(str);
+}
+
+const LazyJSONDocument::Container& LazyJSONDocument::container(uint32_t offset) const {
+  // Binary search (containers are sorted by starting offset)
+  size_t lo = 0, hi = containers.size();
+  while (hi - lo > 1) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (containers[mid].begin <= offset)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  assert(containers[lo].begin == offset);
+  return containers[lo];
+}
+
+JSONValue LazyJSON::type() const {
+  if (doc == NULL)
+    return JSON_UNDEFINED;
+  const char *p = doc->buf.data() + pos;
+  switch (*p) {
+    case '{': return JSON_OBJECT;
+    case '[': return JSON_ARRAY;
+    case '"': return JSON_STRING;
+    case 't': case 'f': return JSON_BOOLEAN;
+    case 'n': return JSON_NULL;
+    default:
+      // A number is a JSON_REAL iff it has a fraction or an exponent
+      for (const char *end = valueEnd(); p != end; ++p) {
+        if (*p == '.' || *p == 'e' || *p == 'E')
+          return JSON_REAL;
+      }
+      return JSON_INTEGER;
+  }
+}
+
+size_t LazyJSON::size() const {
+  const JSONValue typ = type();
+  if (typ != JSON_ARRAY && typ != JSON_OBJECT)
+    throw JSONException("LazyJSON: size()/length() can only be called for JSON_ARRAY/JSON_OBJECT");
+  return doc->container(pos).size;
+}
+
+const char* LazyJSON::valueBegin() const {
+  return doc->buf.data() + pos;
+}
+
+const char* LazyJSON::valueEnd() const {
+  const char *p = doc->buf.data() + pos;
+  switch (*p) {
+    case '{': case '[': return doc->buf.data() + doc->container(pos).end;
+    case '"': return JSON_Utility::skipString(p);
+    default:
+      // Scalars end at whitespace, or structural character (or end of document)
+      const char *end = doc->buf.data() + doc->buf.size();
+      while (p != end && !isspace(static_cast<unsigned char>(*p)) && *p != ',' && *p != ']' && *p != '}')
+        ++p;
+      return p;
+  }
+}
+
+const char* LazyJSON::find(const std::string &key) const {
+  if (type() != JSON_OBJECT)
+    throw JSONException("Cannot use string to index value of a non-JSON_OBJECT using [] operator");
+  const uint32_t count = doc->container(pos).size;
+  const char *p = doc->buf.data() + pos + 1;
+  const char *found = NULL;
+  for (uint32_t i = 0; i < count; ++i) {
+    p = JSON_Utility::skipWhitespace(p);
+    if (i != 0)
+      p = JSON_Utility::skipWhitespace(p + 1); // ,
+    const char *keyStart = p + 1;
+    p = JSON_Utility::skipString(p);
+    const char *keyEnd = p - 1;
+    bool match;
+    if (memchr(keyStart, '\\', keyEnd - keyStart) == NULL)
+      match = (size_t(keyEnd - keyStart) == key.size() && memcmp(keyStart, key.data(), key.size()) == 0);
+    else
+      match = (JSON_Utility::decodeString(keyStart, keyEnd) == key);
+    p = JSON_Utility::skipWhitespace(JSON_Utility::skipWhitespace(p) + 1); // :
+    // Same as JSON::parse(): for duplicate keys, the last one wins
+    if (match)
+      found = p;
+    p = LazyJSON(doc, static_cast<uint32_t>(p - doc->buf.data())).valueEnd();
+  }
+  return found;
+}
+
+const char* LazyJSON::at(size_t indx) const {
+  if (type() != JSON_ARRAY)
+    throw JSONException("Cannot use integer to index value of non-JSON_ARRAY using [] operator");
+  if (indx >= doc->container(pos).size)
+    return NULL;
+  const char *p = JSON_Utility::skipWhitespace(doc->buf.data() + pos + 1);
+  for (size_t i = 0; i < indx; ++i) {
+    p = LazyJSON(doc, static_cast<uint32_t>(p - doc->buf.data())).valueEnd();
+    p = JSON_Utility::skipWhitespace(JSON_Utility::skipWhitespace(p) + 1); // ,
+  }
+  return p;
+}
+
+LazyJSON LazyJSON::operator[](const std::string &key) const {
+  const char *p = find(key);
+  if (p == NULL)
+    throw JSONException("Key not found in JSON_OBJECT: '" + key + "'");
+  return LazyJSON(doc, static_cast<uint32_t>(p - doc->buf.data()));
+}
+
+LazyJSON LazyJSON::operator[](const size_t &indx) const {
+  const char *p = at(indx);
+  if (p == NULL)
+    throw JSONException("Illegal: Out of bound JSON_ARRAY access");
+  return LazyJSON(doc, static_cast<uint32_t>(p - doc->buf.data()));
+}
 
-    if (isArrayStart(ch))
-      j.val = new Array();
+bool LazyJSON::has(const std::string &key) const {
+  return find(key) != NULL;
+}
 
-    // If it's not an object or array, throw error if it was supposed to be a top-level object
-    if (topLevel && j.val == NULL)
-      throw JSONException("JSON::read() - Expected top level JSON to be an Object OR Array");
+bool LazyJSON::has(const size_t &indx) const {
+  return at(indx) != NULL;
+}
 
-    if (isStringStart(ch))
-      j.val = new String();
+JSON LazyJSON::value() const {
+  JSON j;
+  if (doc != NULL)
+    JSON_Utility::readFromBuffer(j, doc->buf.data() + pos, valueEnd(), NULL);
+  return j;
+}
 
-    if (isBooleanStart(ch))
-      j.val = new Boolean();
+JSON LazyJSON::value(JSONArena &arena) const {
+  JSON j;
+  if (doc != NULL)
+    JSON_Utility::readFromBuffer(j, doc->buf.data() + pos, valueEnd(), &arena);
+  return j;
+}
 
-    if (isNullStart(ch))
-      j.val = new Null();
+std::string LazyJSON::toString() const {
+  if (doc == NULL)
+    throw JSONException("Cannot call toString() on an undefined LazyJSON value");
+  return std::string(doc->buf.data() + pos, valueEnd());
+}
 
-    if (j.val != NULL)
-      j.val->read(in);
-    else {
-      // Treat number case slightly differently - since there can be two different types of numbers
+namespace JSON_Utility {
+  // Skips over the next value (see JSONReader::skipValue())
+  void skipValue(ScalarTokenizer &tok) {
+    const int ch = tok.peek();
+    if (ch < 0)
+      throw JSONException("Unexpected EOF");
+    if (isStringStart(ch)) {
+      const char *stop = findStringEnd(tok.p + 1, tok.end);
+      if (stop == NULL)
+        throw JSONException("Unexpected EOF while reading string");
+      tok.p = stop + 1;
+    } else if (isObjectStart(ch) || isArrayStart(ch)) {
+      const bool isObject = isObjectStart(ch);
+      const char close = isObject ? '}' : ']';
+      tok.skip();
+      if (tok.peek() == close) {
+        tok.skip();
+        return;
+      }
+      while (true) {
+        if (isObject) {
+          if (!isStringStart(tok.peek()))
+            throw JSONException("Expected start of a valid object key (string) at this location");
+          skipValue(tok);
+          if (tok.peek() != ':')
+            throw JSONException("Expected : while parsing object");
+          tok.skip();
+        }
+        skipValue(tok);
+        const int next = tok.peek();
+        if (next == close) {
+          tok.skip();
+          return;
+        }
+        if (next != ',')
+          throw JSONException(std::string("Expected , or ") + close + " while skipping " + (isObject ? "object" : "array"));
+        tok.skip();
+      }
+    } else {
+      JSON j;
       if (isNumberStart(ch))
-        j.val = JSON_Utility::ReadNumberValue(in);
+        tok.readNumber(j);
+      else if (isBooleanStart(ch))
+        tok.readBoolean(j);
+      else if (isNullStart(ch))
+        tok.readNull(j);
       else
         throw JSONException("Illegal JSON value. Cannot start with : " + std::string(1, char(ch)));
     }
   }
+}
 
-/*  std::string appendUTF8(uint32_t x) {
-    std::string temp_str = "";
-    //unsigned char tmp[5] = {0};
-    utf8::append(x, std::back_inserter(temp_str));
-    //return std::string(tmp);
-    return temp_str;
-  }*/
-  // See this function in utf8 namespace to fix invalid utf8 characters
-  // void fix_utf8_string(std::string& str);
-
-  inline int32_t hexdigit_to_num(char ch) {
-    if (ch >= '0' && ch <= '9')
-      return uint32_t(ch - '0');
-    ch = toupper(ch);
-    if (ch >= 'A' && ch <= 'F')
-      return uint32_t(ch - 'A' + 10);
-    throw JSONException("Invalid Hex digit in unicode escape \\uxxxx: " + std::string(1,ch));
-  }
-
-  inline int32_t string4_to_hex(char str[]) {
-    // We assume that str is always exactly 4 character long
-    return ( (hexdigit_to_num(str[0]) << 12) +
-             (hexdigit_to_num(str[1]) << 8)  +
-             (hexdigit_to_num(str[2]) << 4) +
-             (hexdigit_to_num(str[3])) );
-  }
-
-  // This function converts a json string (utf8) to a C++ string
-  // All escaped sequences are resolved and it is made sure that no invalid
-  // UTF-8 character is present in string after parsing (any invalid character
-  // is replaced with the replacement character: U+FFFFD)
-  // Care must be taken to not call it two times for a string inside an operation
-  // (for example, while using [] operator)
+JSONReader::JSONReader(const char *begin, const char *end_): p(begin), end(end_), first(false) {}
 
-  std::string parseUtf8JsonString(const std::string &inp) {
-    std::string out = "";
+JSONReader::JSONReader(const std::string &str): p(str.data()), end(str.data() + str.size()), first(false) {}
 
-    std::string temp;
-    size_t inplength = inp.length();
+JSONReader::JSONReader(const LazyJSON &v): first(false) {
+  if (v.doc == NULL)
+    throw JSONException("Cannot read an undefined LazyJSON value");
+  p = v.valueBegin();
+  end = v.valueEnd();
+}
 
-    for (unsigned i = 0; i < inplength; i++) {
-      if (inp[i] != '\\') {
-        out += inp[i];
-      }
-      else {
-        if ( (i + 1) >= inplength)
-          throw JSONException("Cannot end a string with \\ charcter");
-        i++;
-        char hex[4];
-        int32_t first16bit, second16bit;
-        int32_t codepoint;
-        switch(inp[i]) {
-          case '"':  out += '"';   break;
-          case '\\': out += '\\'; break;
-          case '/':  out += '/';   break;
-          case 'b':  out += '\b';  break;
-          case 'f':  out += '\f';  break;
-          case 'n':  out += '\n';  break;
-          case 'r':  out += '\r';  break;
-          case 't':  out += '\t';  break;
+namespace JSON_Utility {
+  // Reads the next value (see JSONReader::readValue())
+  void readWholeValue(ScalarTokenizer &tok, JSON &out) {
+    const int ch = tok.peek();
+    // Scalars are read directly (DOMReader is only needed for arrays/objects)
+    if (isStringStart(ch))
+      tok.readString(out, NULL);
+    else if (isNumberStart(ch))
+      tok.readNumber(out);
+    else if (isBooleanStart(ch))
+      tok.readBoolean(out);
+    else if (isNullStart(ch))
+      tok.readNull(out);
+    else
+      DOMReader<ScalarTokenizer>(tok, NULL).readValue(out);
+  }
+}
 
-          case 'u':
-            if (i + 4 >= inplength)
-              throw JSONException("Expected exactly 4 hex digits after \\u");
-            copy(inp.begin() + i + 1, inp.begin() + i + 1 + 5, hex);
-            i += 4;
-            first16bit = string4_to_hex(hex);
-            codepoint = first16bit;
-            if (0xD800 <= first16bit && first16bit <= 0xDBFF) {
-              // Surrogate pair case
-              // Must have next 6 characters of the form: \uxxxx as well
+void JSONReader::readValue(JSON &out) {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  JSON tmp;
+  JSON_Utility::readWholeValue(tok, tmp);
+  out = std::move(tmp);
+  p = tok.p;
+}
 
-              if ( (i + 6) >= inplength || inp[i + 1] != '\\' || inp[i + 2] != 'u')
-                throw JSONException("Missing surrogate pair in unicode sequence");
-              i += 2;
-              copy(inp.begin() + i + 1, inp.begin() + i + 1 + 5, hex);
-              i += 4;
-              second16bit = string4_to_hex(hex);
+void JSONReader::readString(std::string &out) {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  if (!JSON_Utility::isStringStart(tok.peek()))
+    throw JSONException("Expected a JSON_STRING value");
+  out = tok.readString();
+  p = tok.p;
+}
 
-              if (0xDC00 <= second16bit && second16bit <= 0xDFFF) {
-                /* valid second surrogate */
-                codepoint = ((first16bit - 0xD800) << 10) + (second16bit - 0xDC00) + 0x10000;
-              }
-              else {
-                // Invalid second surrogate
-                throw JSONException("Invalid second 16 bit value in surrogate pair: first 16 bit = " + JSON_Utility::itos(first16bit) + " and second 16 bit = " + JSON_Utility::itos(second16bit));
-              }
-            }
-            try {
-              utf8::append(codepoint, back_inserter(out));
-            }
-            catch(utf8::invalid_code_point &e) {
-                throw JSONException("Invalid UTF-8 code point found in text. Value = " + itos(codepoint) + ". Location = " + inp + "\nInternal message = " + e.what());
-            }
-            break;
-          default:
-            throw JSONException("Illegal escape sequence:" + std::string(1, inp[i]));
-        }
+bool JSONReader::readNull() {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  if (!JSON_Utility::isNullStart(tok.peek()))
+    return false;
+  JSON tmp;
+  tok.readNull(tmp);
+  p = tok.p;
+  return true;
+}
+
+void JSONReader::skipValue() {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  JSON_Utility::skipValue(tok);
+  p = tok.p;
+}
+
+void JSONReader::startObject() {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  if (!JSON_Utility::isObjectStart(tok.peek()))
+    throw JSONException("Expected a JSON_OBJECT value");
+  tok.skip();
+  p = tok.p;
+  first = true;
+}
+
+bool JSONReader::nextKey(std::string &key) {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  int ch = tok.peek();
+  if (ch < 0)
+    throw JSONException("Unexpected EOF while parsing object");
+  if (ch == '}') {
+    tok.skip();
+    p = tok.p;
+    first = false; // The object itself is a completed value in the enclosing array/object
+    return false;
+  }
+  if (!first) {
+    if (ch != ',')
+      throw JSONException("Expected , while parsing object. Got : " + std::string(1, char(ch)));
+    tok.skip();
+    ch = tok.peek();
+  }
+  if (!JSON_Utility::isStringStart(ch))
+    throw JSONException("Expected start of a valid object key (string) at this location");
+  key = tok.readString();
+  if (tok.peek() != ':')
+    throw JSONException("Expected : while parsing object");
+  tok.skip();
+  p = tok.p;
+  first = false;
+  return true;
+}
+
+void JSONReader::startArray() {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  if (!JSON_Utility::isArrayStart(tok.peek()))
+    throw JSONException("Expected a JSON_ARRAY value");
+  tok.skip();
+  p = tok.p;
+  first = true;
+}
+
+bool JSONReader::nextElement() {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  const int ch = tok.peek();
+  if (ch < 0)
+    throw JSONException("Unexpected EOF while parsing array");
+  if (ch == ']') {
+    tok.skip();
+    p = tok.p;
+    first = false;
+    return false;
+  }
+  if (!first) {
+    if (ch != ',')
+      throw JSONException("Expected , while parsing array. Got : " + std::string(1, char(ch)));
+    tok.skip();
+  }
+  p = tok.p;
+  first = false;
+  return true;
+}
+
+JSONPath::JSONPath(const std::string &expr_): expr(expr_) {
+  if (expr.empty())
+    return;
+  if (expr[0] != '/')
+    throw JSONException("Invalid JSONPath expression (must be empty, or start with /): '" + expr + "'");
+  size_t pos = 1;
+  while (true) {
+    const size_t stop = std::min(expr.find('/', pos), expr.size());
+    Step s;
+    for (size_t i = pos; i < stop; ++i) {
+      if (expr[i] != '~') {
+        s.key += expr[i];
+      } else if (i + 1 < stop && (expr[i + 1] == '0' || expr[i + 1] == '1')) {
+        s.key += (expr[++i] == '0') ? '~' : '/';
+      } else {
+        throw JSONException("Invalid escape sequence in JSONPath expression: '" + expr + "'");
       }
     }
-    return getValidatedUTF8String(out);
+    s.wildcard = (stop - pos == 1 && expr[pos] == '*');
+    // Array index: no leading zeros (as in RFC 6901)
+    s.index = std::string::npos;
+    const std::string &k = s.key;
+    if (!k.empty() && k.size() <= 18 && (k.size() == 1 || k[0] != '0') && k.find_first_not_of("0123456789") == std::string::npos)
+      s.index = static_cast<size_t>(strtoull(k.c_str(), NULL, 10));
+    steps.push_back(s);
+    if (stop == expr.size())
+      break;
+    pos = stop + 1;
   }
+}
 
-  std::string ReadString(std::istream &in) {
-    std::string out = "";
-    int ch = in.get();
-    assert(ch == '"'); // First character in a string should be quote
-    std::string str;
-    int prev = 0;
-    do {
-      ch = in.get();
-      if (in.eof() || in.fail())
-        throw JSONException("Unexpected EOF while reading string");
-      if (ch ==  '"' && prev != '\\') // String is over
-        break;
-      str += char(ch);
-      prev = (prev == '\\') ? 0 : ch;
-    } while (1);
-    return parseUtf8JsonString(str);
+void JSONPath::selectIn(const JSON &j, size_t step, std::vector<const JSON*> &out, bool firstOnly) const {
+  if (step == steps.size()) {
+    out.push_back(&j);
+    return;
+  }
+  const Step &s = steps[step];
+  if (j.type() == JSON_OBJECT) {
+    const JSON::object_storage &obj = j.val.obj->val;
+    if (s.wildcard) {
+      for (JSON::object_storage::const_iterator it = obj.begin(); it != obj.end() && !(firstOnly && !out.empty()); ++it)
+        selectIn(it->second, step + 1, out, firstOnly);
+    } else {
+      JSON::object_storage::const_iterator it = obj.find(s.key);
+      if (it != obj.end())
+        selectIn(it->second, step + 1, out, firstOnly);
+    }
+  } else if (j.type() == JSON_ARRAY) {
+    const JSON::array_storage &arr = j.val.arr->val;
+    if (s.wildcard) {
+      for (size_t i = 0; i < arr.size() && !(firstOnly && !out.empty()); ++i)
+        selectIn(arr[i], step + 1, out, firstOnly);
+    } else if (s.index < arr.size()) {
+      selectIn(arr[s.index], step + 1, out, firstOnly);
+    }
   }
 }
 
-void String::write(std::ostream &out) const {
-  JSON_Utility::WriteEscapedString(this->val, out, true);
+void JSONPath::select(const JSON &root, std::vector<const JSON*> &out) const {
+  selectIn(root, 0, out, false);
 }
 
-void Object::write(std::ostream &out) const {
-  out<<"{";
-  bool firstElem = true;
+const JSON* JSONPath::find(const JSON &root) const {
+  std::vector<const JSON*> out;
+  selectIn(root, 0, out, true);
+  return out.empty() ? NULL : out[0];
+}
 
-  for (std::map<std::string, JSON>::const_iterator it = val.begin(); it != val.end(); ++it, firstElem = false) {
-    if (!firstElem)
-      out<<",";
-    JSON_Utility::WriteEscapedString((*it).first, out, true);
-    out<<":";
-    (*it).second.write(out);
+namespace JSON_Utility {
+  // Returns true if the raw characters [start, stop) of a json string decode to "key"
+  bool isEqualKey(const char *start, const char *stop, const std::string &key) {
+    // Plain ASCII strings (the usual case) are compared without decoding them
+    bool plain = true;
+    for (const char *p = start; p != stop && plain; ++p)
+      plain = (*p != '\\' && static_cast<unsigned char>(*p) < 0x80);
+    if (plain)
+      return (size_t(stop - start) == key.size() && memcmp(start, key.data(), key.size()) == 0);
+    return decodeString(start, stop) == key;
   }
-  out<<"}";
 }
 
-void Array::write(std::ostream &out) const {
-  out<<"[";
-  bool firstElem = true;
-  for (unsigned i = 0; i < val.size(); ++i, firstElem = false) {
-    if (!firstElem)
-      out<<",";
-    val[i].write(out);
+const char* JSONPath::selectIn(const char *p, const char *end, size_t step, std::vector<JSON> &out) const {
+  JSON_Utility::ScalarTokenizer tok(p, end);
+  if (step == steps.size()) {
+    out.push_back(JSON());
+    JSON_Utility::readWholeValue(tok, out.back());
+    return tok.p;
+  }
+  const int ch = tok.peek();
+  const bool isObject = JSON_Utility::isObjectStart(ch);
+  if (!isObject && !JSON_Utility::isArrayStart(ch)) {
+    JSON_Utility::skipValue(tok);
+    return tok.p;
+  }
+  const Step &s = steps[step];
+  const char close = isObject ? '}' : ']';
+  tok.skip();
+  if (tok.peek() == close) {
+    tok.skip();
+    return tok.p;
+  }
+  for (size_t i = 0; ; ++i) {
+    bool match = s.wildcard || (!isObject && i == s.index);
+    if (isObject) {
+      if (!JSON_Utility::isStringStart(tok.peek()))
+        throw JSONException("Expected start of a valid object key (string) at this location");
+      const char *start, *stop;
+      tok.readRawString(start, stop);
+      match = match || JSON_Utility::isEqualKey(start, stop, s.key);
+      if (tok.peek() != ':')
+        throw JSONException("Expected : while parsing object");
+      tok.skip();
+    }
+    if (match)
+      tok.p = selectIn(tok.p, end, step + 1, out);
+    else
+      JSON_Utility::skipValue(tok);
+    const int next = tok.peek();
+    if (next == close) {
+      tok.skip();
+      return tok.p;
+    }
+    if (next != ',')
+      throw JSONException(std::string("Expected , or ") + close + " while parsing " + (isObject ? "object" : "array"));
+    tok.skip();
   }
-  out<<"]";
 }
 
-const JSON& Array::jsonAtIndex(size_t i) const {
-  if (val.size() == 0u || i >= val.size())
-    throw JSONException("Illegal: Out of bound JSON_ARRAY access");
-  return val[i];
+const char* JSONPath::select(const char *begin, const char *end, std::vector<JSON> &out) const {
+  const size_t n = out.size();
+  try {
+    return selectIn(begin, end, 0, out);
+  } catch (...) {
+    out.resize(n); // Do not leave partial results behind
+    throw;
+  }
 }
 
-// STL map's [] operator cannot be used on constant objects
-const JSON& Object::jsonAtKey(const std::string &s) const {
-  std::map<std::string, JSON>::const_iterator it = this->val.find(s);
-  if (it == val.end())
-    throw JSONException("Cannot add new key to a constant JSON_OBJECT");
-  return it->second;
+void JSONPath::select(const std::string &str, std::vector<JSON> &out) const {
+  select(str.data(), str.data() + str.size(), out);
 }
 
-JSON& Object::jsonAtKey(const std::string &s) {
-  return val[s];
+void JSONPath::select(const LazyJSON &v, std::vector<JSON> &out) const {
+  if (v.doc == NULL)
+    throw JSONException("Cannot select from an undefined LazyJSON value");
+  select(v.valueBegin(), v.valueEnd(), out);
 }
 
-void JSON::write(std::ostream &out) const {
-  if (this->type() == JSON_UNDEFINED) {
-    throw JSONException("Cannot call write() method on uninitialized json object");
+JSONArena::JSONArena(size_t chunkSize): cur(NULL), limit(NULL), nextChunkSize(chunkSize), totalSize(0u) {
+  if (nextChunkSize < 64u)
+    nextChunkSize = 64u;
+}
+
+JSONArena::~JSONArena() {
+  for (size_t i = 0; i < chunks.size(); ++i)
+    free(chunks[i].data);
+}
+
+void* JSONArena::allocateFromNewChunk(size_t size, size_t alignment) {
+  // Chunks grow geometrically (upto 4MB), unless a single large block is requested
+  const size_t MAX_CHUNK_SIZE = 4 * 1024 * 1024;
+  size_t chunkSize = std::max(nextChunkSize, size + alignment);
+  Chunk c;
+  c.data = static_cast<char*>(malloc(chunkSize));
+  if (c.data == NULL)
+    throw std::bad_alloc();
+  c.size = chunkSize;
+  chunks.push_back(c);
+  totalSize += chunkSize;
+  if (nextChunkSize < MAX_CHUNK_SIZE)
+    nextChunkSize *= 2;
+
+  cur = c.data;
+  limit = c.data + c.size;
+  return allocate(size, alignment);
+}
+
+void JSONArena::reset() {
+  if (chunks.empty())
+    return;
+  size_t largest = 0;
+  for (size_t i = 1; i < chunks.size(); ++i) {
+    if (chunks[i].size > chunks[largest].size)
+      largest = i;
+  }
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    if (i != largest)
+      free(chunks[i].data);
+  }
+  chunks[0] = chunks[largest];
+  chunks.resize(1);
+  totalSize = chunks[0].size;
+  cur = chunks[0].data;
+  limit = cur + chunks[0].size;
+}
+
+void JSON::copyOutOfLineStorage(const JSON &rhs) {
+  // Note: Copy is always allocated on heap (storage in an arena is never shared)
+  const bool share = json_copy_on_write && !(rhs.tag & IN_ARENA);
+  switch (rhs.type()) {
+    case JSON_STRING: JSON_Utility::setString(*this, rhs.stringData(), rhs.stringSize(), NULL); break;
+    case JSON_ARRAY:
+      if (share && rhs.val.arr->shared.shareable) {
+        rhs.val.arr->shared.refs.fetch_add(1, std::memory_order_relaxed);
+        val.arr = rhs.val.arr;
+      } else {
+        val.arr = new Array(*rhs.val.arr);
+      }
+      tag = JSON_ARRAY;
+      break;
+    case JSON_OBJECT:
+      if (share && rhs.val.obj->shared.shareable) {
+        rhs.val.obj->shared.refs.fetch_add(1, std::memory_order_relaxed);
+        val.obj = rhs.val.obj;
+      } else {
+        val.obj = new Object(*rhs.val.obj);
+      }
+      tag = JSON_OBJECT;
+      break;
+    default: assert(false); // Should never happen
   }
-  out.precision(std::numeric_limits<double>::digits10);
-  val->write(out);
-  out.flush();
 }
 
-void JSON::readFromString(const std::string &jstr) {
-  std::stringstream inp(jstr);
-  this->read(inp);
+void JSON::releaseOutOfLineStorage() {
+  const bool inArena = (tag & IN_ARENA) != 0;
+  switch (type()) {
+    case JSON_STRING:
+      if (!inArena)
+        delete [] val.str;
+      break;
+    case JSON_ARRAY:
+      if (inArena)
+        val.arr->~Array(); // Memory is owned by the arena
+      else if (val.arr->shared.refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete val.arr;
+      break;
+    case JSON_OBJECT:
+      if (inArena)
+        val.obj->~Object();
+      else if (val.obj->shared.refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete val.obj;
+      break;
+    default: assert(false); // Should never happen
+  }
 }
 
 const JSON& JSON::operator[](const std::string &s) const {
   if (this->type() != JSON_OBJECT)
     throw JSONException("Cannot use string to index value of a non-JSON_OBJECT using [] operator");
 
-  // No need for dynamic_cast (since I already checked for JSON_OBJECT case), and
-  // dynamic_cast is expensive
-  const Object *o = static_cast<Object*>(val);
-  return o->jsonAtKey(s);
+  // STL map's [] operator cannot be used on constant objects
+  JSON::object_storage::const_iterator it = val.obj->val.find(s);
+  if (it == val.obj->val.end())
+    throw JSONException("Cannot add new key to a constant JSON_OBJECT");
+  return it->second;
 }
 
 // For non-const JSON objects
 JSON& JSON::operator[](const std::string &s) {
   if (this->type() != JSON_OBJECT)
     throw JSONException("Cannot use string to index value of a non-JSON_OBJECT using [] operator");
-
-  // No need for dynamic_cast (since I already checked for JSON_OBJECT case), and
-  // dynamic_cast is expensive
-  Object *o = static_cast<Object*>(val);
-  return o->jsonAtKey(s);
+  return JSON_Utility::mutableObject(*this, true)[s];
 }
 
 const JSON& JSON::operator[](const char *str) const {
@@ -501,8 +2371,10 @@ JSON& JSON::operator[](const char *str) {
 const JSON& JSON::operator[](const size_t &indx) const {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot use integer to index value of non-JSON_ARRAY using [] operator");
-  Array *a = static_cast<Array*>(val);
-  return a->jsonAtIndex(indx);
+  const JSON::array_storage &arr = val.arr->val;
+  if (indx >= arr.size())
+    throw JSONException("Illegal: Out of bound JSON_ARRAY access");
+  return arr[indx];
 }
 
 const JSON& JSON::operator[](const JSON &j) const {
@@ -512,9 +2384,7 @@ const JSON& JSON::operator[](const JSON &j) const {
   if (this->type() == JSON_OBJECT) {
     if (j.type() != JSON_STRING)
       throw JSONException("Cannot use a non-string value to index JSON_OBJECT using []");
-
-    String *ptr = static_cast<String*>(j.val);
-    return (*this)[ptr->val];
+    return (*this)[std::string(j.stringData(), j.stringSize())];
   }
   throw JSONException("Only JSON_OBJECT and JSON_ARRAY can be indexed using []");
 }
@@ -526,43 +2396,38 @@ JSON& JSON::operator[](const JSON &j) {
   if (this->type() == JSON_OBJECT) {
     if (j.type() != JSON_STRING)
       throw JSONException("Cannot use a non-string value to index JSON_OBJECT using []");
-
-    String *ptr = static_cast<String*>(j.val);
-    return (*this)[ptr->val];
+    return (*this)[std::string(j.stringData(), j.stringSize())];
   }
   throw JSONException("Only JSON_OBJECT and JSON_ARRAY can be indexed using []");
 }
 
-// A dirty hack for creating non-const versions of [] (for array indexing) overload using const versions above
-JSON& JSON::operator [](const size_t &indx) { return const_cast<JSON&>( (*(const_cast<const JSON*>(this)))[indx]); }
-//JSON& JSON::operator [](const std::string &s) { return const_cast<JSON&>( (*(const_cast<const JSON*>(this)))[s]); }
-//JSON& JSON::operator [](const JSON &j) { return const_cast<JSON&>( (*(const_cast<const JSON*>(this)))[j]); }
-//JSON& JSON::operator [](const char *str) { return const_cast<JSON&>( (*(const_cast<const JSON*>(this)))[str]); }
-
-JSON::JSON(const JSONValue &rhs) {
-  val = NULL; // So that clear() works fine on this, else we will be deallocating some arbitrary memory - dangerous!
-  *this = operator=(rhs);
+// For non-const JSON arrays
+JSON& JSON::operator [](const size_t &indx) {
+  if (this->type() != JSON_ARRAY)
+    throw JSONException("Cannot use integer to index value of non-JSON_ARRAY using [] operator");
+  JSON::array_storage &arr = JSON_Utility::mutableArray(*this, true);
+  if (indx >= arr.size())
+    throw JSONException("Illegal: Out of bound JSON_ARRAY access");
+  return arr[indx];
 }
 
-JSON::JSON(const JSON &rhs) {
-  if (rhs.type() != JSON_UNDEFINED)
-    val = rhs.val->returnMyNewCopy();
-  else
-    val = NULL;
+JSON::JSON(const JSONValue &rhs): len(0), tag(JSON_UNDEFINED) {
+  operator=(rhs);
 }
 
 JSON& JSON::operator =(const JSONValue &rhs) {
   clear();
   switch(rhs) {
-    case JSON_ARRAY: val = new Array(); break;
-    case JSON_OBJECT: val = new Object(); break;
-    case JSON_INTEGER: val = new Integer(); break;
-    case JSON_REAL: val = new Real(); break;
-    case JSON_STRING: val = new String(); break;
-    case JSON_BOOLEAN: val = new Boolean(); break;
-    case JSON_NULL: val = new Null(); break;
+    case JSON_ARRAY: val.arr = new Array(); break;
+    case JSON_OBJECT: val.obj = new Object(); break;
+    case JSON_INTEGER: val.i = 0; break;
+    case JSON_REAL: val.d = 0.0; break;
+    case JSON_STRING: JSON_Utility::setString(*this, "", 0, NULL); return *this;
+    case JSON_BOOLEAN: val.b = false; break;
+    case JSON_NULL: break;
     default: throw JSONException("Illegal JSONValue value for JSON initialization");
   }
+  tag = rhs;
   return *this;
 }
 
@@ -570,19 +2435,16 @@ JSON& JSON::operator =(const JSON &rhs) {
   if (this == &rhs) // Self-assignment check
     return *this;
 
+  // Copy first: rhs might be a part of current value
+  JSON tmp(rhs);
   clear();
-
-  if (rhs.type() != JSON_UNDEFINED)
-    val = rhs.val->returnMyNewCopy();
-  else
-    val = NULL;
-
+  JSON_Utility::relocate(*this, tmp);
   return *this;
 }
 
 JSON& JSON::operator =(const std::string &s) {
   clear();
-  val = new String(s);
+  JSON_Utility::setString(*this, s.data(), s.size(), NULL);
   return *this;
 }
 
@@ -592,14 +2454,15 @@ JSON& JSON::operator =(const char &c) {
 
 JSON& JSON::operator =(const bool &x) {
   clear();
-  val = new Boolean(x);
+  val.b = x;
+  tag = JSON_BOOLEAN;
   return *this;
 }
 
 JSON& JSON::operator =(const Null &x __attribute__ ((unused)) ) {
   // x is intended to be unused in this function. Since null has exactly one value.
   clear();
-  val = new Null();
+  tag = JSON_NULL;
   return *this;
 }
 
@@ -609,53 +2472,52 @@ JSON& JSON::operator =(const char s[]) {
 
 
 size_t JSON::size() const {
-  // Using static_cast everywhere instead of dynamic_cast, since we explicitly check it's type
-  // before statically casting, and dynamic_cast is expensive
-
-  JSONValue t = type();
-  if (t != JSON_ARRAY && t != JSON_OBJECT && t != JSON_STRING)
-    throw JSONException("size()/length() can only be called for JSON_ARRAY/JSON_OBJECT/JSON_STRING");
-  if (t == JSON_ARRAY) {
-    Array *tmp = static_cast<Array*>(this->val);
-    return tmp->val.size();
-  }
-  else {
-    if (t == JSON_OBJECT) {
-      Object *tmp = static_cast<Object*>(this->val);
-      return tmp->val.size();
-    }
+  switch (type()) {
+    case JSON_ARRAY: return val.arr->val.size();
+    case JSON_OBJECT: return val.obj->val.size();
+    case JSON_STRING: return stringSize();
+    default: throw JSONException("size()/length() can only be called for JSON_ARRAY/JSON_OBJECT/JSON_STRING");
   }
-  String *tmp = static_cast<String*>(this->val);
-  return tmp->val.size();
 }
 
 void JSON::push_back(const JSON &j) {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot push_back to a non-array");
-  Array *tmp = static_cast<Array*>(this->val);
-  assert(tmp != NULL);
-  tmp->push_back(j);
+  JSON_Utility::mutableArray(*this, false).push_back(j);
+}
+
+void JSON::push_back(JSON &&j) {
+  if (this->type() != JSON_ARRAY)
+    throw JSONException("Cannot push_back to a non-array");
+  JSON_Utility::mutableArray(*this, false).push_back(std::move(j));
+}
+
+JSON& JSON::insert(const std::string &key, JSON &&j) {
+  if (this->type() != JSON_OBJECT)
+    throw JSONException("Cannot insert a key in a non-object");
+  JSON &slot = JSON_Utility::mutableObject(*this, true)[key];
+  slot = std::move(j);
+  return slot;
 }
 
 std::string JSON::toString(bool onlyTopLevel) const {
   if (onlyTopLevel && this->type() != JSON_OBJECT && this->type() != JSON_ARRAY)
     throw JSONException("Only a JSON_OBJECT/JSON_ARRAY can call toString() with onlyTopLevel flag set to true");
-  std::stringstream in;
-  write(in);
-  return in.str();
+  std::string out;
+  writeTo(out);
+  return out;
 }
 
 bool JSON::has(const size_t &indx) const {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Illegal call to has(size_t) for non JSON_ARRAY object");
-  size_t size = ((Array*)(this->val))->val.size();
-  return (indx < size);
+  return (indx < val.arr->val.size());
 }
 
 bool JSON::has(const std::string &key) const {
   if (this->type() != JSON_OBJECT)
     throw JSONException("Illegal call to has(size_t) for non JSON_OBJECT object");
-  return (((Object*)(this->val))->val.count(key) > 0u);
+  return (val.obj->val.count(key) > 0u);
 }
 
 bool JSON::has(const char *x) const {
@@ -665,331 +2527,299 @@ bool JSON::has(const char *x) const {
 bool JSON::has(const JSON &j) const {
 
   switch(this->type()) {
-    case JSON_ARRAY: return has((const size_t)j);
+    case JSON_ARRAY: return has(size_t(j));
     case JSON_OBJECT:
       if (j.type() != JSON_STRING)
         throw JSONException("For a JSON_OBJECT, has(JSON &j) requires j to be JSON_STRING");
-      return has( ((String*)(j.val))->val);
+      return has(std::string(j.stringData(), j.stringSize()));
 
     default: throw JSONException("Illegal json object as input to has(const JSON &j)");
   }
 }
 
+namespace JSON_Utility {
+  // Characters which can appear in a number
+  inline bool isNumberChar(int ch) {
+    return isdigit(ch) || ch == '+' || ch == '-' || ch == '.' || ch == 'e' || ch == 'E';
+  }
+
+  // Copies text of the next JSON value in "in" to "buf", without consuming any
+  // character past it (so that rest of the stream can be read normally, even if
+  // it's not seekable, e.g., a pipe). Only finds where the value ends: the text
+  // is validated by the buffer parser.
+  void readValueText(std::istream &in, std::string &buf) {
+    typedef std::char_traits<char> traits;
+    std::streambuf *sb = in.rdbuf();
+    int c = sb->sgetc();
+    while (c != traits::eof() && isspace(c))
+      c = sb->snextc();
+    if (c == traits::eof()) {
+      in.setstate(std::ios::eofbit);
+      return;
+    }
+    if (c == '[' || c == '{' || c == '"') {
+      size_t depth = 0;
+      bool inString = false, escaped = false;
+      do {
+        const char ch = traits::to_char_type(c);
+        buf.push_back(ch);
+        if (inString) {
+          if (escaped)
+            escaped = false;
+          else if (ch == '\\')
+            escaped = true;
+          else if (ch == '"')
+            inString = false;
+        } else if (ch == '"') {
+          inString = true;
+        } else if (ch == '[' || ch == '{') {
+          ++depth;
+        } else if (ch == ']' || ch == '}') {
+          --depth;
+        }
+        c = sb->snextc();
+      } while (c != traits::eof() && (inString || depth > 0));
+    } else {
+      // A number, or one of true/false/null
+      const bool literal = isalpha(c);
+      do {
+        buf.push_back(traits::to_char_type(c));
+        c = sb->snextc();
+      } while (c != traits::eof() && (literal ? isalpha(c) : isNumberChar(c)));
+    }
+    if (c == traits::eof())
+      in.setstate(std::ios::eofbit);
+  }
+}
+
 void JSON::read(std::istream &in) {
-  JSON_Utility::ReadJSONValue(in, *this, false);
+  // Copy text of the value (and nothing past it) into a contiguous buffer, and
+  // let the buffer parser do the real work
+  std::string buf;
+  JSON_Utility::readValueText(in, buf);
+  readFromBuffer(buf.data(), buf.data() + buf.size());
+}
+
+JSON JSON::parseFile(const std::string &path) {
+  MappedFile file;
+  bool opened;
+  try {
+    opened = file.open(path);
+  } catch (std::exception &e) {
+    throw JSONException(e.what());
+  }
+  if (!opened)
+    throw JSONException("Unable to open file: '" + path + "'");
+  return parse(file.begin(), file.end());
 }
 
 void JSON::erase(const size_t &indx) {
   if (this->type() != JSON_ARRAY)
     throw JSONException("erase(size_t) can only be called for a JSON_ARRAY");
-  (static_cast<Array*>(this->val))->erase(indx);
+  JSON::array_storage &arr = JSON_Utility::mutableArray(*this, false);
+  if (indx >= arr.size())
+    throw JSONException("Cannot erase out of bound element in a JSON_ARRAY. indx supplied = " + boost::lexical_cast<std::string>(indx));
+  arr.erase(arr.begin() + indx);
 }
 
-void JSON::erase(const std::string &indx) {
+void JSON::erase(const std::string &key) {
   if (this->type() != JSON_OBJECT)
     throw JSONException("erase(string) can only be called for a JSON_OBJECT");
-  (static_cast<Object*>(this->val))->erase(indx);
-}
-
-void String::read(std::istream &in) {
-  val = JSON_Utility::ReadString(in);
-}
-
-void Boolean::read(std::istream &in) {
-
-  // To store output of read() - maximum = "false", artificially adding "\0" at end
-  // since read() does not.
-  char str[6] = {0};
-
-  str[0] = in.get();
-  bool fail = false;
-  unsigned size = 0;
-  if (str[0] == 't')
-    size = 3; // read "rue"
-  else
-    size = 4; // read "alse"
-
-  in.read(&str[1], size);
-  fail = (in.gcount() == size) ? false : true;
-  if (!fail && size == 3u && (strcmp(str, "true") == 0))
-    val = true;
-  else
-    if (!fail && size == 4u && (strcmp(str, "false") == 0))
-      val = false;
-    else
-      fail = true;
-
-  if (fail)
-    throw JSONException("Invalid Boolean value, expected exactly one of : 'true' or 'false'");
-}
-
-void Null::read(std::istream &in) {
-  char str[5] = {0};
-  in.read(str, 4);
-  if (in.gcount() !=4 || (strcmp(str, "null") != 0))
-    throw JSONException("Invalid JSON null, expected exactly: null");
+  if (JSON_Utility::mutableObject(*this, false).erase(key) == 0)
+    throw JSONException("Cannot erase non-existent key from a JSON_OBJECT. Key supplied = " + key);
 }
 
-void Object::read(std::istream &in) {
-  int ch;
-  val.clear();
-  JSON_Utility::SkipWhiteSpace(in);
-  ch = in.get();
-  assert(ch == '{'); // Must be a valid object for Object::read to be called
+namespace JSON_Utility {
+  const uint64_t HASH_MULTIPLIER = 0x9e3779b97f4a7c15ull;
 
-  bool firstKey = true;
-  do {
-    JSON_Utility::SkipWhiteSpace(in);
-    ch = in.get();
-    if (in.eof() || in.fail())
-      throw JSONException("Unexpected EOF while parsing object. ch = " + std::string(1, ch));
-
-    // End of parsing for this JSON object
-    if (ch == '}')
-      break;
+  // Finalizer of MurmurHash3 (every input bit affects every output bit)
+  inline uint64_t mixHash(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+  }
 
-    // Keys:value pairs must be separated by , inside JSON object
-    if (!firstKey && ch != ',')
-      throw JSONException("Expected , while parsing object. Got : " + std::string(1, ch));
+  inline uint64_t combineHash(uint64_t seed, uint64_t h) {
+    return mixHash((seed ^ h) * HASH_MULTIPLIER + (seed >> 29));
+  }
 
-    if (!firstKey) {
-      JSON_Utility::SkipWhiteSpace(in);
-      ch = in.get();
+  // Hash of the bytes [s, s + n), read as little endian 64 bit words
+  // (independently of the byte order of the platform)
+  uint64_t hashBytes(const char *s, size_t n) {
+    uint64_t h = n * HASH_MULTIPLIER;
+    for (;; s += 8, n -= 8) {
+      const size_t m = (n < 8) ? n : 8;
+      uint64_t w = 0;
+      for (size_t i = 0; i < m; ++i)
+        w |= static_cast<uint64_t>(static_cast<unsigned char>(s[i])) << (8 * i);
+      h = combineHash(h, w);
+      if (n <= 8)
+        return h;
     }
+  }
 
-    if (!JSON_Utility::isStringStart(ch))
-      throw JSONException("Expected start of a valid object key (string) at this location");
-
-    // Push back the quote (") in stream again, and parse the key value (string)
-    in.unget();
-
-    std::string key = JSON_Utility::ReadString(in);
-    JSON_Utility::SkipWhiteSpace(in);
-    ch = in.get();
-    if (ch != ':')
-      throw JSONException("Expected :, got : " + std::string(1, ch));
-    JSON_Utility::SkipWhiteSpace(in);
-    JSON_Utility::ReadJSONValue(in, val[key], false);
-    firstKey = false;
-  } while (true);
-}
-
-void Array::read(std::istream &in) {
-  int ch;
-  val.clear();
-  JSON_Utility::SkipWhiteSpace(in);
-  ch = in.get();
-  assert(ch == '['); // Must be a valid array for Array::read to be called
-
-  bool firstKey = true;
-  do {
-    JSON_Utility::SkipWhiteSpace(in);
-    ch = in.get();
-    if (in.eof() || in.fail())
-      throw JSONException("Unexpected EOF while parsing array");
-
-    // End of parsing this array
-    if (ch == ']')
-      break;
-
-    if (!firstKey && ch != ',')
-      throw JSONException("Expected ,(comma) GOT: " + std::string(1, ch));
-
-    if (!firstKey) {
-      JSON_Utility::SkipWhiteSpace(in);
+  // Reals are hashed by the bucket they fall in. Buckets are 1024 times wider
+  // than the tolerance used by isEqualReal(): getEpsilon() for |d| < 1, and
+  // getEpsilon() * 2^exp in the binade [2^(exp-1), 2^exp) otherwise. So equal
+  // values land in different buckets only if they straddle a boundary.
+  uint64_t hashReal(double d) {
+    if (!boost::math::isfinite(d)) {
+      uint64_t bits;
+      memcpy(&bits, &d, sizeof(bits));
+      return bits;
     }
-    else
-      in.unget();
-
-    JSON_Utility::SkipWhiteSpace(in);
-    JSON tmpValue;
-    val.push_back(tmpValue); // Append a blank json object. We will fill it soon
-    JSON_Utility::ReadJSONValue(in, val[val.size() - 1u], false);
-    firstKey = false;
-  } while (true);
-}
-
-void Object::erase(const std::string &key) {
-  if (val.erase(key) == 0)
-    throw JSONException("Cannot erase non-existent key from a JSON_OBJECT. Key supplied = " + key);
-}
-
-void Array::erase(const size_t &indx) {
-  if (indx >= val.size())
-    throw JSONException("Cannot erase out of bound element in a JSON_ARRAY. indx supplied = " + boost::lexical_cast<std::string>(indx));
-  val.erase(val.begin() + indx);
-}
-
-bool Integer::isEqual(const Value *other) const {
-  const Integer *p = dynamic_cast<const Integer*>(other);
-  return (p != NULL && this->val == p->val);
-}
-
-bool Real::isEqual(const Value* other) const {
-  const Real *p = dynamic_cast<const Real*>(other);
-  
-  // In our implementation of isEqual, "Real" is *never* equal to Integer
-  // TODO: Decide if this is desired behavior ?
-  if (p == NULL)
-    return false;
-
-  //Ref: 1. http://floating-point-gui.de/errors/comparison/
-  //     2. http://randomascii.wordpress.com/2012/02/25/comparing-floating-point-numbers-2012-edition/
-  double diff = fabs(this->val - p->val);
-  double eps = JSON::getEpsilon();
-
-  // If numbers are really close (absolute error), return true
-  // needed for numbers near zero
-  if (diff <= eps) {
-    return true;
+    int exp = 0;
+    const double m = (fabs(d) >= 1.0) ? frexp(d, &exp) : d; // |m| < 1
+    const int64_t bucket = static_cast<int64_t>(floor(m / (1024 * JSON::getEpsilon()) + 0.5)); // Zero is in the middle of a bucket
+    return combineHash(static_cast<uint64_t>(exp), static_cast<uint64_t>(bucket));
   }
-  // Now use absolute error to check for "closeness"
-  double absA = fabs(this->val);
-  double absB = fabs(p->val);
-  double largest = (absA > absB) ? absA : absB;
-  // always use largest to check for relative error
-  // so that isEqual() remain commutative
-  return diff <= (largest * eps);
-}
-
-bool String::isEqual(const Value* other) const {
-  const String *p = dynamic_cast<const String*>(other);
-  return (p != NULL && this->val == p->val);
-}
-
-bool Boolean::isEqual(const Value* other) const {
-  const Boolean *p = dynamic_cast<const Boolean*>(other);
-  return (p != NULL && this->val == p->val);
-}
-
-bool Null::isEqual(const Value* other) const {
-  const Null *p = dynamic_cast<const Null*>(other);
-  return (p != NULL);
-}
-
-bool Array::isEqual(const Value* other) const {
-  const Array *p = dynamic_cast<const Array*>(other);
-  return (p != NULL && this->val.size() == p->val.size() && equal(this->val.begin(), this->val.end(), p->val.begin()));
-}
 
-bool Object::isEqual(const Value* other) const {
-  const Object *p = dynamic_cast<const Object*>(other);
-  if (p == NULL || this->val.size() != p->val.size())
-    return false;
-  std::map<std::string, JSON>::const_iterator it1,it2;
-  for (it1 = this->val.begin(), it2 = p->val.begin(); it1 != this->val.end() && it2 != p->val.end(); ++it1, ++it2) {
-    if (it1->first != it2->first || it1->second != it2->second)
-      return false;
+  // Implementation of JSON::hash()
+  uint64_t hashValue(const JSON &j) {
+    const JSONValue t = j.type();
+    uint64_t h = mixHash(static_cast<uint64_t>(t) + 1);
+    switch (t) {
+      case JSON_INTEGER: return combineHash(h, static_cast<uint64_t>(j.val.i));
+      case JSON_REAL: return combineHash(h, hashReal(j.val.d));
+      case JSON_BOOLEAN: return combineHash(h, j.val.b ? 1 : 0);
+      case JSON_STRING: return combineHash(h, hashBytes(j.stringData(), j.stringSize()));
+      case JSON_ARRAY: {
+        const JSON::array_storage &arr = j.val.arr->val;
+        h = combineHash(h, arr.size());
+        for (size_t i = 0; i < arr.size(); ++i)
+          h = combineHash(h, hashValue(arr[i]));
+        return h;
+      }
+      case JSON_OBJECT: {
+        // Members are sorted by key, so equal objects are always visited in the same order
+        const JSON::object_storage &obj = j.val.obj->val;
+        h = combineHash(h, obj.size());
+        for (JSON::object_storage::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+          h = combineHash(h, hashBytes(it->first.data(), it->first.size()));
+          h = combineHash(h, hashValue(it->second));
+        }
+        return h;
+      }
+      default: return h; // JSON_NULL, JSON_UNDEFINED
+    }
   }
-  return (it1 == this->val.end() && it2 == p->val.end());
 }
 
+uint64_t JSON::hash() const {
+  return JSON_Utility::hashValue(*this);
+}
 
 bool JSON::operator ==(const JSON& other) const {
   if (this->type() != other.type() || this->type() == JSON_UNDEFINED)
     return false;
-  return (this->val->isEqual(other.val));
+  switch (type()) {
+    case JSON_INTEGER: return val.i == other.val.i;
+    // In our implementation, "Real" is *never* equal to Integer
+    // TODO: Decide if this is desired behavior ?
+    case JSON_REAL: return JSON_Utility::isEqualReal(val.d, other.val.d);
+    case JSON_BOOLEAN: return val.b == other.val.b;
+    case JSON_NULL: return true;
+    case JSON_STRING: {
+      const size_t n = stringSize();
+      return (n == other.stringSize() && memcmp(stringData(), other.stringData(), n) == 0);
+    }
+    case JSON_ARRAY: {
+      const JSON::array_storage &a1 = val.arr->val, &a2 = other.val.arr->val;
+      return (a1.size() == a2.size() && equal(a1.begin(), a1.end(), a2.begin()));
+    }
+    case JSON_OBJECT: {
+      const JSON::object_storage &o1 = val.obj->val, &o2 = other.val.obj->val;
+      if (o1.size() != o2.size())
+        return false;
+      JSON::object_storage::const_iterator it1, it2;
+      for (it1 = o1.begin(), it2 = o2.begin(); it1 != o1.end() && it2 != o2.end(); ++it1, ++it2) {
+        if (it1->first != it2->first || it1->second != it2->second)
+          return false;
+      }
+      return (it1 == o1.end() && it2 == o2.end());
+    }
+    default: assert(false); // Should never happen
+  }
+  return false;
 }
 
 JSON::const_object_iterator JSON::object_begin() const {
   if (this->type() != JSON_OBJECT)
     throw JSONException("Cannot get JSON::object_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.begin();
+  return val.obj->val.begin();
 }
 
 JSON::const_array_iterator JSON::array_begin() const {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.begin();
+  return val.arr->val.begin();
 }
 
 JSON::object_iterator JSON::object_begin() {
   if (this->type() != JSON_OBJECT)
     throw JSONException("Cannot get JSON::object_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.begin();
+  return JSON_Utility::mutableObject(*this, true).begin();
 }
 
 JSON::array_iterator JSON::array_begin() {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.begin();
+  return JSON_Utility::mutableArray(*this, true).begin();
 }
 
 JSON::const_object_iterator JSON::object_end() const {
   if (this->type() != JSON_OBJECT)
     throw JSONException("Cannot get JSON::object_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.end();
+  return val.obj->val.end();
 }
 
 JSON::const_array_iterator JSON::array_end() const {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.end();
+  return val.arr->val.end();
 }
 
 JSON::object_iterator JSON::object_end() {
   if (this->type() != JSON_OBJECT)
     throw JSONException("Cannot get JSON::object_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.end();
+  return JSON_Utility::mutableObject(*this, true).end();
 }
 
 JSON::array_iterator JSON::array_end() {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.end();
+  return JSON_Utility::mutableArray(*this, true).end();
 }
-/*
-// Reverse iterators
-JSON::const_object_reverse_iterator JSON::object_rbegin() const {
-  if (this->type() != JSON_OBJECT)
-    throw JSONException("Cannot get JSON::object_reverse_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.rbegin();
-}
-*/
+
 JSON::const_array_reverse_iterator JSON::array_rbegin() const {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_reverse_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.rbegin();
-}
-/*
-JSON::object_reverse_iterator JSON::object_rbegin() {
-  if (this->type() != JSON_OBJECT)
-    throw JSONException("Cannot get JSON::object_reverse_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.rbegin();
+  return val.arr->val.rbegin();
 }
-*/
+
 JSON::array_reverse_iterator JSON::array_rbegin() {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_reverse_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.rbegin();
-}
-/*
-JSON::const_object_reverse_iterator JSON::object_rend() const {
-  if (this->type() != JSON_OBJECT)
-    throw JSONException("Cannot get JSON::object_reverse_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.rend();
+  return JSON_Utility::mutableArray(*this, true).rbegin();
 }
-*/
+
 JSON::const_array_reverse_iterator JSON::array_rend() const {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_reverse_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.rend();
-}
-/*
-JSON::object_reverse_iterator JSON::object_rend() {
-  if (this->type() != JSON_OBJECT)
-    throw JSONException("Cannot get JSON::object_reverse_iterator for a non-JSON_OBJECT");
-  return (static_cast<Object*>(this->val))->val.rend();
+  return val.arr->val.rend();
 }
-*/
+
 JSON::array_reverse_iterator JSON::array_rend() {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot get JSON::array_reverse_iterator for a non-JSON_ARRAY");
-  return (static_cast<Array*>(this->val))->val.rend();
+  return JSON_Utility::mutableArray(*this, true).rend();
 }
 
 void JSON::resize_array(size_t desired_size) {
   if (this->type() != JSON_ARRAY)
     throw JSONException("Cannot call resize_array() on a non JSON_ARRAY object");
-  (static_cast<Array*>(this->val))->val.resize(desired_size);
+  JSON_Utility::mutableArray(*this, false).resize(desired_size);
 }
@@ -34,9 +34,14 @@
 #include <typeinfo>
 #include <cmath>
 #include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <iterator>
+#include <atomic>
 #include <stdint.h>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/iterator/indirect_iterator.hpp>
 
 #include "utf8/utf8.h"
 
@@ -47,6 +52,10 @@
 
 /** @file */
 
+namespace JSON_Utility {
+  class PushParser;
+}
+
 /** @namespace dx This is the namespace which contain the JSON and JSONException
                   class
   */
@@ -109,27 +118,365 @@ namespace dx {
     JSON_NULL = 7
   };
 
-  /** An abstract base class to allow making a heterogenous container
-   *  Classes for all possible JSON values are derived from this base class.
-   */
-  class Value {
+  /** A region (arena) allocator for JSON values.
+    * A JSONArena can be passed to parse() and readFromBuffer(), in which case all
+    * the values created while parsing (and storage of arrays/objects, including
+    * their later growth) are carved out of a few large chunks owned by the arena.
+    * Nothing is returned to the system until the arena is reset() or destroyed,
+    * at which point all of it is released at once. This makes parsing, and
+    * tearing down, large short-lived documents (e.g., API responses) much cheaper.
+    *
+    * @note
+    * - Every JSON value allocated from an arena must be destroyed before the
+    *   arena is destroyed (or reset()), i.e., declare the arena first.
+    * - Copying such a JSON (copy constructor/assignment) creates an ordinary
+    *   heap-allocated copy, which is independent of the arena.
+    * - Moving such a JSON (move constructor/assignment, swap()) does not: the
+    *   moved-to value still refers to storage owned by the arena, so it must
+    *   not outlive the arena either. Make a copy if it's needed for longer.
+    * - A JSONArena is not thread safe.
+    */
+  class JSONArena {
+  public:
+    /** Creates an empty arena. No memory is allocated until first use.
+      * @param chunkSize Size (in bytes) of the first chunk allocated by the arena.
+      * Subsequent chunks are progressively larger.
+      */
+    explicit JSONArena(size_t chunkSize = 16 * 1024);
+
+    /** Releases all the memory owned by the arena. */
+    ~JSONArena();
+
+    /** Returns a block of "size" bytes, aligned to "alignment" (a power of 2).
+      * The block remains valid until the arena is reset() or destroyed.
+      */
+    void* allocate(size_t size, size_t alignment) {
+      uintptr_t p = (reinterpret_cast<uintptr_t>(cur) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+      if (cur == NULL || p + size > reinterpret_cast<uintptr_t>(limit))
+        return allocateFromNewChunk(size, alignment);
+      cur = reinterpret_cast<char*>(p + size);
+      return reinterpret_cast<void*>(p);
+    }
+
+    /** Makes all the memory owned by the arena available for reuse (the
+      * largest chunk is retained, all others are released).
+      */
+    void reset();
+
+    /** Returns total number of bytes currently owned by the arena. */
+    size_t capacity() const { return totalSize; }
+
+  private:
+    struct Chunk {
+      char *data;
+      size_t size;
+    };
+    std::vector<Chunk> chunks;
+    char *cur; // Next free byte in last chunk
+    char *limit; // End of last chunk
+    size_t nextChunkSize;
+    size_t totalSize;
+
+    void* allocateFromNewChunk(size_t size, size_t alignment);
+
+    // Not copyable
+    JSONArena(const JSONArena &);
+    JSONArena& operator=(const JSONArena &);
+  };
+
+  /** STL allocator used for storage of JSON_ARRAY and JSON_OBJECT values. It
+    * allocates from a JSONArena if one is provided, or from heap otherwise
+    * (default). Memory allocated from arena is never freed individually.
+    */
+  template<typename T>
+  class JSONArenaAllocator {
   public:
-    virtual JSONValue type() const = 0; // Return type of particular derived class
-    virtual void write(std::ostream &out) const = 0;
-    virtual Value* returnMyNewCopy() const = 0;
-    virtual void read(std::istream &in) = 0;
-    virtual bool isEqual(const Value* other) const = 0;
-    virtual ~Value() { }
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template<typename U>
+    struct rebind {
+      typedef JSONArenaAllocator<U> other;
+    };
+
+    JSONArena *arena;
+
+    JSONArenaAllocator(JSONArena *a = NULL): arena(a) {}
+
+    template<typename U>
+    JSONArenaAllocator(const JSONArenaAllocator<U> &other): arena(other.arena) {}
+
+    pointer allocate(size_type n, const void * = 0) {
+      if (arena != NULL)
+        return static_cast<pointer>(arena->allocate(n * sizeof(T), __alignof__(T)));
+      return static_cast<pointer>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(pointer p, size_type) {
+      if (arena == NULL)
+        ::operator delete(p);
+    }
+
+    // Copy of a container is never allocated from the arena
+    JSONArenaAllocator select_on_container_copy_construction() const { return JSONArenaAllocator(); }
+
+    // Storage is exchanged (rather than copied) together with the allocator,
+    // so containers with different arenas can be swapped or move assigned
+    typedef std::true_type propagate_on_container_swap;
+    typedef std::true_type propagate_on_container_move_assignment;
+
+    // Forwards the arguments, so that containers move (rather than copy) elements when possible
+    template<typename U, typename... Args>
+    void construct(U *p, Args&&... args) { new (static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+    template<typename U>
+    void destroy(U *p) { p->~U(); }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+
+    template<typename U>
+    bool operator ==(const JSONArenaAllocator<U> &other) const { return arena == other.arena; }
+    template<typename U>
+    bool operator !=(const JSONArenaAllocator<U> &other) const { return arena != other.arena; }
+  };
+
+  /** @internal Storage of the members of a JSON_OBJECT: a vector of pointers
+    * to the (key, value) pairs, kept sorted by key. Lookups are binary
+    * searches over the pointers, and iteration order is the same as of a
+    * std::map (sorted by key, so output of JSON::write() is deterministic).
+    * The pairs themselves are stored in blocks of slots, which are never
+    * moved: all the members read by the parser share a single block (see
+    * reserve() and append()), and keys inserted later get slots of an erased
+    * member, or from a new block (as big as the object is, so that total
+    * number of slots doubles).
+    * So (same as std::map) references to members stay valid until they are
+    * erased. Inserting a new key takes linear time, and invalidates
+    * iterators.
+    */
+  template<typename T>
+  class SortedObjectStorage {
+  public:
+    typedef std::pair<const std::string, T> value_type;
+    typedef JSONArenaAllocator<value_type> allocator_type;
+    typedef std::vector<value_type*, JSONArenaAllocator<value_type*> > index_type;
+    typedef typename index_type::size_type size_type;
+    typedef boost::indirect_iterator<typename index_type::iterator> iterator;
+    typedef boost::indirect_iterator<typename index_type::const_iterator, const value_type> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    SortedObjectStorage(): blocks(NULL), next(NULL), last(NULL), freeSlots(NULL) {}
+    explicit SortedObjectStorage(const allocator_type &alloc_)
+      : alloc(alloc_), index(alloc_), blocks(NULL), next(NULL), last(NULL), freeSlots(NULL) {}
+
+    // Copies are always on heap (same as copies of the other containers)
+    template<typename It>
+    SortedObjectStorage(It first, It end): blocks(NULL), next(NULL), last(NULL), freeSlots(NULL) {
+      reserve(std::distance(first, end));
+      for (; first != end; ++first)
+        (*this)[first->first] = first->second;
+    }
+
+    SortedObjectStorage(const SortedObjectStorage &other): blocks(NULL), next(NULL), last(NULL), freeSlots(NULL) {
+      reserve(other.size());
+      for (const_iterator it = other.begin(); it != other.end(); ++it)
+        append(std::string(it->first)) = it->second;
+    }
+
+    SortedObjectStorage(SortedObjectStorage &&other)
+      : alloc(other.alloc), index(other.alloc), blocks(NULL), next(NULL), last(NULL), freeSlots(NULL) {
+      swap(other);
+    }
+
+    ~SortedObjectStorage() { clear(); }
+
+    SortedObjectStorage& operator =(SortedObjectStorage other) {
+      swap(other);
+      return *this;
+    }
+
+    void swap(SortedObjectStorage &other) {
+      std::swap(alloc, other.alloc);
+      index.swap(other.index);
+      std::swap(blocks, other.blocks);
+      std::swap(next, other.next);
+      std::swap(last, other.last);
+      std::swap(freeSlots, other.freeSlots);
+    }
+
+    allocator_type get_allocator() const { return alloc; }
+
+    iterator begin() { return index.begin(); }
+    const_iterator begin() const { return index.begin(); }
+    iterator end() { return index.end(); }
+    const_iterator end() const { return index.end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    size_type size() const { return index.size(); }
+    bool empty() const { return index.empty(); }
+
+    void clear() {
+      for (size_t i = 0; i < index.size(); ++i)
+        alloc.destroy(index[i]);
+      index.clear();
+      while (blocks != NULL) {
+        const BlockHeader header = *reinterpret_cast<BlockHeader*>(blocks);
+        alloc.deallocate(blocks, header.size + 1);
+        blocks = header.prev;
+      }
+      next = last = freeSlots = NULL;
+    }
+
+    /** Makes room for n members in total, so that adding them allocates no further memory */
+    void reserve(size_type n) {
+      index.reserve(n);
+      if (n > index.size() && size_type(last - next) < n - index.size())
+        newBlock(n - index.size());
+    }
+
+    iterator find(const std::string &key) {
+      typename index_type::iterator it = lowerBound(index.begin(), index.end(), key);
+      return (it != index.end() && (*it)->first == key) ? it : index.end();
+    }
+
+    const_iterator find(const std::string &key) const {
+      typename index_type::const_iterator it = lowerBound(index.begin(), index.end(), key);
+      return (it != index.end() && (*it)->first == key) ? it : index.end();
+    }
+
+    size_type count(const std::string &key) const { return (find(key) != end()) ? 1u : 0u; }
+
+    /** Returns value stored under "key" (inserting a default constructed value if not present) */
+    T& operator [](const std::string &key) {
+      // Fast path for keys inserted in sorted order
+      if (index.empty() || index.back()->first < key)
+        return append(std::string(key));
+      typename index_type::iterator it = lowerBound(index.begin(), index.end(), key);
+      if ((*it)->first != key)
+        it = insertAt(it, key, T());
+      return (*it)->second;
+    }
+
+    /** Inserts "x" (if it's key is not present already), same as std::map::insert() */
+    std::pair<iterator, bool> insert(value_type &&x) {
+      typename index_type::iterator it = lowerBound(index.begin(), index.end(), x.first);
+      if (it != index.end() && (*it)->first == x.first)
+        return std::make_pair(iterator(it), false);
+      return std::make_pair(iterator(insertAt(it, x.first, std::move(x.second))), true);
+    }
+
+    /** Removes "key" (if present), and returns number of values removed (0 or 1) */
+    size_type erase(const std::string &key) {
+      typename index_type::iterator it = lowerBound(index.begin(), index.end(), key);
+      if (it == index.end() || (*it)->first != key)
+        return 0u;
+      value_type *p = *it;
+      index.erase(it);
+      releaseSlot(p);
+      return 1u;
+    }
+
+    /** Appends a member, whose key must be greater than all the keys present
+      * (used by the parser, which sorts keys of an object before storing them).
+      */
+    T& append(std::string &&key) {
+      assert(index.empty() || index.back()->first < key);
+      return (*insertAt(index.end(), std::move(key), T()))->second;
+    }
+
+  private:
+    allocator_type alloc;
+    index_type index; // Pointers to the members, sorted by key
+    value_type *blocks; // Last block of slots (NULL if none)
+    value_type *next, *last; // Slots of the last block, which have never been used
+    value_type *freeSlots; // Slots of erased members: a linked list (stored in the slots themselves)
+
+    // First slot of each block is used for linking the blocks together
+    struct BlockHeader {
+      value_type *prev;
+      size_type size; // Number of slots (excluding the header)
+    };
+
+    void newBlock(size_type n) {
+      static_assert(sizeof(value_type) >= sizeof(BlockHeader), "A slot must be able to hold a BlockHeader");
+      value_type *p = alloc.allocate(n + 1);
+      BlockHeader header = {blocks, n};
+      *reinterpret_cast<BlockHeader*>(p) = header;
+      blocks = p;
+      next = p + 1;
+      last = p + 1 + n;
+    }
+
+    void releaseSlot(value_type *p) {
+      alloc.destroy(p);
+      *reinterpret_cast<value_type**>(p) = freeSlots;
+      freeSlots = p;
+    }
+
+    // Constructs a member in a free slot, and inserts it into index at "pos"
+    template<typename K>
+    typename index_type::iterator insertAt(typename index_type::iterator pos, K &&key, T &&value) {
+      if (index.size() == index.capacity()) {
+        const size_t offset = pos - index.begin();
+        index.reserve(std::max<size_type>(2 * index.size(), 4u));
+        pos = index.begin() + offset;
+      }
+      value_type *p;
+      if (freeSlots != NULL) {
+        p = freeSlots;
+        freeSlots = *reinterpret_cast<value_type**>(p);
+      } else {
+        if (next == last)
+          newBlock(std::max<size_type>(index.size(), 4u));
+        p = next++;
+      }
+      try {
+        alloc.construct(p, std::forward<K>(key), std::move(value));
+      } catch (...) {
+        *reinterpret_cast<value_type**>(p) = freeSlots;
+        freeSlots = p;
+        throw;
+      }
+      return index.insert(pos, p); // Does not throw (capacity is reserved)
+    }
+
+    template<typename It>
+    static It lowerBound(It first, It last, const std::string &key) {
+      typename std::iterator_traits<It>::difference_type n = last - first;
+      while (n > 0) {
+        const typename std::iterator_traits<It>::difference_type half = n / 2;
+        if (first[half]->first < key) {
+          first += half + 1;
+          n -= half + 1;
+        } else {
+          n = half;
+        }
+      }
+      return first;
+    }
+  };
+
+  /** An empty class, representing the JSON value: null.
+    * Assigning a Null() to a JSON object makes it JSON_NULL.
+    */
+  class Null {
+  public:
+    bool operator ==(const Null&) const { return true; }
+    bool operator !=(const Null&) const { return false; }
   };
 
   // Forward declarations
-  class Integer;
-  class Real;
-  class Null;
-  class Boolean;
-  class String;
   class Array;
   class Object;
+  class JSONHandler;
 
   /** The JSON class. Object of this class are capable of storing/operating on
     * arbitrary JSON values.
@@ -137,19 +484,48 @@ namespace dx {
   class JSON {
   public:
     
-    typedef std::map<std::string, JSON>::iterator object_iterator;
-    typedef std::map<std::string, JSON>::const_iterator const_object_iterator;
-    typedef std::vector<JSON>::iterator array_iterator;
-    typedef std::vector<JSON>::const_iterator const_array_iterator;
-
-    typedef std::map<std::string, JSON>::const_reverse_iterator object_reverse_iterator;
-    typedef std::map<std::string, JSON>::reverse_iterator const_object_reverse_iterator;
-    typedef std::vector<JSON>::reverse_iterator array_reverse_iterator;
-    typedef std::vector<JSON>::const_reverse_iterator const_array_reverse_iterator;
-
-    /** This will store pointer to actual JSON value
+    // Containers used for storing JSON_OBJECT and JSON_ARRAY values
+    typedef SortedObjectStorage<JSON> object_storage;
+    typedef std::vector<JSON, JSONArenaAllocator<JSON> > array_storage;
+
+    typedef object_storage::iterator object_iterator;
+    typedef object_storage::const_iterator const_object_iterator;
+    typedef array_storage::iterator array_iterator;
+    typedef array_storage::const_iterator const_array_iterator;
+
+    typedef object_storage::const_reverse_iterator object_reverse_iterator;
+    typedef object_storage::reverse_iterator const_object_reverse_iterator;
+    typedef array_storage::reverse_iterator array_reverse_iterator;
+    typedef array_storage::const_reverse_iterator const_array_reverse_iterator;
+
+    /** @internal
+      * Every JSON object is exactly 16 bytes. Integers, reals, booleans, null,
+      * and strings of upto MAX_INLINE_STRING bytes are stored inline (an inline
+      * string occupies the bytes of "val" and "ext"). Longer strings, arrays
+      * and objects are stored out-of-line: on heap, or in a JSONArena (if
+      * the IN_ARENA flag is set).
       */
-    Value *val;
+    union {
+      int64_t i;
+      double d;
+      bool b;
+      char *str; // Out-of-line string (not NULL terminated, length is stored in "ext")
+      Array *arr;
+      Object *obj;
+    } val;
+    uint8_t ext[6];
+    uint8_t len; // Length of an inline string
+    uint8_t tag; // JSONValue (type), and flags below
+
+    /** @internal Bits in JSON::tag */
+    enum {
+      TYPE_MASK = 0x0f,
+      STRING_INLINE = 0x10, // JSON_STRING stored inline
+      IN_ARENA = 0x20 // Out-of-line storage is owned by a JSONArena
+    };
+
+    /** Longest string which can be stored inline (without any heap allocation) */
+    static const size_t MAX_INLINE_STRING = 14;
 
     /** Returns the current "epsilon" paramerer value.
       * This value determines the "slack" while checking equality
@@ -159,25 +535,129 @@ namespace dx {
       */
     static double getEpsilon();
 
+    /** Enables (or disables) copy-on-write in this process: when enabled,
+      * copying a JSON_ARRAY/JSON_OBJECT (e.g., with the copy constructor,
+      * or by storing it in a container) shares its storage (and so the
+      * whole tree below it), instead of making a deep copy. Copies are then
+      * O(1), and the storage is only copied (one level at a time, along the
+      * path being modified) when a shared value is modified.
+      * Values which have been accessed through a non-const reference or
+      * iterator (e.g., the non-const operator[]) are still deep copied at that
+      * level, so modifications made through such references never leak into
+      * other copies. Storage allocated from a JSONArena is never shared.
+      * @note With copy-on-write, a const reference into a value (e.g.,
+      *       const JSON &x = j["a"]) may refer to storage of another copy once
+      *       j is modified, and must not be used after that (same as an
+      *       iterator invalidated by a modification).
+      * @param enabled true to enable copy-on-write (default: false)
+      */
+    static void setCopyOnWrite(bool enabled);
+
+    /** Returns true if copy-on-write is enabled.
+      * @see setCopyOnWrite()
+      */
+    static bool getCopyOnWrite();
+
     /** Creates a new JSON object from a serialized representation.
       * See notes for read() (applies here as well)
       * @param str The serialized json object.
       * @return
       */
     static JSON parse(const std::string &str) {
+      return parse(str.data(), str.data() + str.size());
+    }
+
+    /** Creates a new JSON object from a serialized representation stored in
+      * the contiguous buffer [begin, end). The buffer is read in place (no copy is made).
+      * See notes for read() (applies here as well)
+      * @param begin Pointer to first character of the serialized json
+      * @param end Pointer past the last character of the buffer
+      * @return
+      */
+    static JSON parse(const char *begin, const char *end) {
+      JSON tmp;
+      tmp.readFromBuffer(begin, end);
+      return tmp;
+    }
+
+    /** Creates a new JSON object from the serialized json value stored in a
+      * file. The file is memory mapped (see MappedFile, in dxutil), and parsed
+      * in place, so it's never copied into memory as a whole.
+      * See notes for read() (applies here as well)
+      * @param path Path of the file
+      * @return
+      * @throw JSONException If the file can not be read, or does not contain
+      *        a valid json value
+      */
+    static JSON parseFile(const std::string &path);
+
+    /** Same as parse(const std::string&), except that the returned value is
+      * allocated from the given arena (see JSONArena for caveats).
+      */
+    static JSON parse(const std::string &str, JSONArena &arena) {
+      return parse(str.data(), str.data() + str.size(), arena);
+    }
+
+    /** Same as parse(const char*, const char*), except that the returned value
+      * is allocated from the given arena (see JSONArena for caveats).
+      */
+    static JSON parse(const char *begin, const char *end, JSONArena &arena) {
       JSON tmp;
-      tmp.readFromString(str);
+      tmp.readFromBuffer(begin, end, arena);
       return tmp;
     }
 
+    /** Reads the serialized json value stored in the buffer [begin, end), without
+      * building a JSON object for it: instead, the value is reported (in order) to
+      * the given handler, as a sequence of events (see JSONHandler). Memory use is
+      * independent of size of the input (except for subtrees captured by handler).
+      * See notes for read() (applies here as well).
+      * @param begin Pointer to first character of the buffer
+      * @param end Pointer past the last character of the buffer
+      * @param handler Receives the events
+      * @return Pointer to the first character after the JSON value read
+      * @exception JSONException If buffer contain illegaly formatted JSON (events
+      *            reported before the error was found are not undone). Exceptions
+      *            thrown by the handler are propagated as is.
+      */
+    static const char* readEvents(const char *begin, const char *end, JSONHandler &handler);
+
+    /** Same as readEvents(const char*, const char*, JSONHandler&), for a serialized
+      * json value stored in a string.
+      */
+    static const char* readEvents(const std::string &str, JSONHandler &handler) {
+      return readEvents(str.data(), str.data() + str.size(), handler);
+    }
+
     /** Default constructor for JSON. Creates JSON of type JSON_UNDEFINED.
       */
-    JSON():val(NULL) {}
+    JSON(): len(0), tag(JSON_UNDEFINED) { val.i = 0; }
 
     /** Copy constructor
       * @param rhs This is the JSON object which will be copied.
       */
-    JSON(const JSON &rhs);
+    JSON(const JSON &rhs) {
+      if (rhs.hasOutOfLineStorage()) {
+        tag = JSON_UNDEFINED;
+        copyOutOfLineStorage(rhs);
+      } else {
+        val = rhs.val;
+        memcpy(ext, rhs.ext, sizeof(ext));
+        len = rhs.len;
+        tag = rhs.tag;
+      }
+    }
+
+    /** Move constructor. Takes over the value of rhs (no deep copy is made),
+      * rhs.type() == JSON_UNDEFINED after the call.
+      * @note If rhs was allocated from a JSONArena, the new object still
+      *       refers to storage owned by that arena.
+      * @param rhs The JSON object to be moved from.
+      */
+    JSON(JSON &&rhs) noexcept: val(rhs.val), len(rhs.len), tag(rhs.tag) {
+      memcpy(ext, rhs.ext, sizeof(ext));
+      rhs.tag = JSON_UNDEFINED;
+    }
 
     /** Construct a blank JSON object of a particular JSONValue type, i.e.,
       * (this->type() == rhs) after construction.
@@ -194,7 +674,31 @@ namespace dx {
 
     /** Clears the content of JSON object. 
       * this->type() == JSON_UNDEFINED after the call*/
-    void clear() { delete val; val=NULL; }
+    void clear() {
+      if (hasOutOfLineStorage())
+        releaseOutOfLineStorage();
+      tag = JSON_UNDEFINED;
+    }
+
+    /** @internal Returns true if value is stored (at least partially) outside of this object */
+    bool hasOutOfLineStorage() const {
+      const JSONValue t = type();
+      return (t == JSON_ARRAY || t == JSON_OBJECT || (t == JSON_STRING && !(tag & STRING_INLINE)));
+    }
+
+    /** @internal Returns pointer to the characters of a JSON_STRING (not NULL terminated) */
+    const char* stringData() const {
+      return (tag & STRING_INLINE) ? reinterpret_cast<const char*>(this) : val.str;
+    }
+
+    /** @internal Returns length of a JSON_STRING (in bytes) */
+    size_t stringSize() const {
+      if (tag & STRING_INLINE)
+        return len;
+      uint32_t n;
+      memcpy(&n, ext, sizeof(n));
+      return n;
+    }
 
     /** Writes the serialized JSON object to the output stream
       * @param out Output stream object, to which the serialized object will be written to
@@ -204,6 +708,23 @@ namespace dx {
       */
     void write(std::ostream &out) const;
 
+    /** Appends the serialized JSON object to a string (same output as write()).
+      * Nothing else is done to the string, so a single buffer can be reused
+      * (e.g., cleared, keeping its capacity) for serializing many values.
+      * @param out String to which the serialized object will be appended
+      * @throw JSONException If some value is JSON_UNDEFINED (serialization
+      *        of values preceding it will already have been appended to out)
+      * @see write()
+      * @see toString()
+      */
+    void writeTo(std::string &out) const;
+
+    /** Appends a serialized JSON_STRING with value "s" (i.e., escaped and
+      * enclosed in quotes) to "out", same as JSON(s).writeTo(out), but without
+      * making a copy of "s".
+      */
+    static void writeString(const std::string &s, std::string &out);
+
     /** Reads and populates current JSON object from specified input stream
       * containing a valid serialized represntation of JSON value.
       * @note 
@@ -227,6 +748,11 @@ namespace dx {
       *  - If stream contains: 'truHtrue' then function will throw an
       *    error, since characters 'truHtrue' do not represent any legal
       *    JSON value starting from first location.
+      * - Arrays/objects nested more than 1000 levels deep are rejected (this
+      *   applies to all the readers, including readBinary() and JSONPushParser).
+      * - Only the characters of the value are consumed from the stream (so it
+      *   works on pipes, sockets, and std::cin, and consecutive values can be
+      *   read one by one); they are then parsed using readFromBuffer().
       * @param in Input stream object (for reading the serialized JSON)
       * @throw JSONException If string being read is illegal JSON, or error
       * occured while reading the stream.
@@ -244,6 +770,59 @@ namespace dx {
       */
     void readFromString(const std::string &jstr); // Populate JSON from a string
 
+    /** Populates current JSON object from the serialized json value stored in
+      * the buffer [begin, end). This is the fastest way of reading JSON, since
+      * characters are directly read from the buffer.
+      * See notes for read() (applies here as well).
+      * @param begin Pointer to first character of the buffer
+      * @param end Pointer past the last character of the buffer
+      * @return Pointer to the first character after the JSON value read
+      * @exception JSONException If buffer contain illegaly formatted JSON
+      * @see readFromString()
+      */
+    const char* readFromBuffer(const char *begin, const char *end);
+
+    /** Same as readFromBuffer(const char*, const char*), except that the
+      * new value is allocated from the given arena (see JSONArena for caveats).
+      * @param begin Pointer to first character of the buffer
+      * @param end Pointer past the last character of the buffer
+      * @param arena The arena to allocate from
+      * @return Pointer to the first character after the JSON value read
+      * @exception JSONException If buffer contain illegaly formatted JSON
+      */
+    const char* readFromBuffer(const char *begin, const char *end, JSONArena &arena);
+
+    /** Appends a compact binary encoding of the JSON object to "out". The
+      * encoding is CBOR (RFC 7049), restricted to definite length items:
+      * JSON_INTEGER is stored as a CBOR integer, and JSON_REAL always as a
+      * 64 bit float, so both type and value survive readBinary() exactly.
+      * Like writeTo(), nothing else is done to the string.
+      * @param out String to which the encoded object will be appended
+      * @throw JSONException If some value is JSON_UNDEFINED
+      * @see readBinary()
+      */
+    void writeBinary(std::string &out) const;
+
+    /** Populates current JSON object from the binary encoded value (see
+      * writeBinary()) stored in the buffer [begin, end), e.g., a memory mapped
+      * file. Values are decoded directly from the buffer into their final
+      * storage. Other (non-dxjson) CBOR encoders can be read as well, as long
+      * as they use only definite length maps (with text keys), arrays, text
+      * strings, integers, floats, booleans, and null (tags are ignored).
+      * Strings that are not valid UTF-8 are fixed the same way as by read().
+      * @param begin Pointer to first byte of the buffer
+      * @param end Pointer past the last byte of the buffer
+      * @return Pointer to the first byte after the value read
+      * @exception JSONException If the buffer does not contain a valid encoding
+      * @see writeBinary()
+      */
+    const char* readBinary(const char *begin, const char *end);
+
+    /** Same as readBinary(const char*, const char*), except that the
+      * new value is allocated from the given arena (see JSONArena for caveats).
+      */
+    const char* readBinary(const char *begin, const char *end, JSONArena &arena);
+
     /** Returns the stringified representation of JSON object.
       * @param onlyTopLevel If set to true, then only JSON objects of type JSON_OBJECT
       *                     or JSON_ARRAY can call this function.
@@ -271,6 +850,24 @@ namespace dx {
       */
     bool operator !=(const JSON& other) const { return !(*this == other); }
 
+    /** Returns a 64 bit structural hash of the value, which is consistent with
+      * operator==() (equal values have equal hashes), and stable (the same
+      * value has the same hash in every process and on every platform), so
+      * it can be used for keys of persistent caches as well.
+      * @note JSON_REAL values are compared with a tolerance (see getEpsilon()),
+      *       so reals are hashed by a bucket (1024 times wider than the
+      *       tolerance) which they fall in. Since equality with a tolerance is
+      *       not transitive, no bucketing can keep all equal reals together:
+      *       equal values on two sides of a bucket boundary (e.g., 2.0 and the
+      *       largest double below it, which are in different binades) have
+      *       different hashes, and are then distinct keys of an unordered_map.
+      *       Use integers (or strings) for keys where this matters.
+      * @note The hash is computed on every call (it's not cached, since any
+      *       value can still be modified through a reference to it).
+      * @return The hash value
+      */
+    uint64_t hash() const;
+
     /** Access value stored inside a JSON array by numeric index
       * @param indx Index location to be accessed inside current JSON array.
       * @return A constant reference to JSON value stored at given location
@@ -323,6 +920,8 @@ namespace dx {
       * @note Returns a non-constant JSON reference (can be modified).
       * @note If the specified key (parameter s) is not present, then it will be created in the object
       *       and it's initial value will be set to JSON_UNDEFINED
+      * @note Creating a new key invalidates iterators (but not references) to other
+      *       values stored in the same object.
       * @see const JSON& operator[](const std::string &s)
       */
     JSON& operator [](const std::string &s);
@@ -347,7 +946,7 @@ namespace dx {
       * @see const JSON& operator[](const JSON &indx)
       */
     template<typename T>
-    JSON& operator [](const T& x) { return const_cast<JSON&>( (*(const_cast<const JSON*>(this)))[x]); }
+    JSON& operator [](const T& x) { return (*this)[static_cast<size_t>(x)]; }
 
     /** Sets the current JSON object's value to the provided numeric value.
       * This is a templatized version, specialized only for numeric types.
@@ -365,6 +964,35 @@ namespace dx {
       * @return Reference to current object (to allow chaining of = operations).
       */
     JSON& operator =(const JSON &);
+
+    /** Moves the provided JSON object's value to current JSON object (no deep
+      * copy is made). rhs.type() == JSON_UNDEFINED after the call.
+      * @note Current value of object will be erased. It is safe to move
+      *       a value contained inside current object (e.g., j = std::move(j["a"])).
+      * @note If rhs was allocated from a JSONArena, current object will refer to
+      *       storage owned by that arena (and must not outlive it) after the call.
+      * @param rhs The value which will be moved to current object.
+      * @return Reference to current object (to allow chaining of = operations).
+      */
+    JSON& operator =(JSON &&rhs) noexcept {
+      if (this != &rhs) {
+        // Detach first: rhs might be a part of current value
+        JSON tmp(std::move(rhs));
+        clear();
+        swap(tmp);
+      }
+      return *this;
+    }
+
+    /** Exchanges values of current JSON object and "other" (no deep copy is made).
+      * @param other The JSON object to swap values with.
+      */
+    void swap(JSON &other) noexcept {
+      unsigned char tmp[sizeof(JSON)];
+      memcpy(tmp, static_cast<const void*>(this), sizeof(JSON));
+      memmove(static_cast<void*>(this), static_cast<const void*>(&other), sizeof(JSON));
+      memcpy(static_cast<void*>(&other), tmp, sizeof(JSON));
+    }
     
     /** Creates a blank JSON object of a particular JSONValue type, i.e.,
       * this->type() == rhs; to the function, after the call.
@@ -417,6 +1045,12 @@ namespace dx {
     template<typename T>
     JSON& operator =(const std::vector<T> &vec);
 
+    /** Same as operator=(const std::vector<T>&), except that elements are
+      * moved (rather than copied) out of the given vector.
+      */
+    template<typename T>
+    JSON& operator =(std::vector<T> &&vec);
+
     /** Copies the provided std::map value to current JSON object (as a JSON_OBJECT)
       * @note Current value of object will be erased.
       * @param rhs The value which will be copied to current object.
@@ -425,6 +1059,12 @@ namespace dx {
     template<typename T>
     JSON& operator =(const std::map<std::string, T> &m);
 
+    /** Same as operator=(const std::map<std::string, T>&), except that values
+      * are moved (rather than copied) out of the given map.
+      */
+    template<typename T>
+    JSON& operator =(std::map<std::string, T> &&m);
+
     /** Conversion operator. Currently only typecasting to a numeric type (real/integer/bool)
       * is supported.
       * @return The typecasted value of JSON object in requested type.
@@ -447,7 +1087,7 @@ namespace dx {
     /** Returns the type of current JSON object.
       * @return Type (a variable of type enum JSONValue) of current JSON object.
       */
-    JSONValue type() const { return (val == NULL) ? JSON_UNDEFINED : val->type(); }
+    JSONValue type() const { return static_cast<JSONValue>(tag & TYPE_MASK); }
 
     /** Resizes an JSON_ARRAY.
       * If current size of array = curr_size, and desired size provided by user = desired_size, then
@@ -520,6 +1160,22 @@ namespace dx {
       */
     void push_back(const JSON &j);
 
+    /** Same as push_back(const JSON&), except that the value is moved
+      * (rather than copied) into the array.
+      * @throw JSONException If called for non JSON_ARRAY object.
+      * @param j The value to be appended to array.
+      */
+    void push_back(JSON &&j);
+
+    /** Inserts a new key/value pair in current JSON_OBJECT, moving the value
+      * into the object. If key already exists, it's value is replaced.
+      * @throw JSONException If called for non JSON_OBJECT object.
+      * @param key The key to be inserted.
+      * @param j The value to be moved into the object.
+      * @return Reference to the inserted value.
+      */
+    JSON& insert(const std::string &key, JSON &&j);
+
     /** Removes a particular index inside a JSON_ARRAY
       * @throw JSONException If called for non JSON_ARRAY object.
       * @param indx The index to be removed from array
@@ -609,156 +1265,518 @@ namespace dx {
 
     /** Erases and deallocate any memory for the current JSON object */
     ~JSON() { clear(); }
+
+  private:
+    void copyOutOfLineStorage(const JSON &rhs);
+    void releaseOutOfLineStorage();
   };
 
-  class Integer: public Value {
+  /** Interface for receiving a json value as a stream of events (see JSON::readEvents()),
+    * e.g., the value {"a": [1, "x"]} is reported as: onStartObject(), onKey("a"),
+    * onStartArray(), onInt64(1), onString("x"), onEndArray(), onEndObject().
+    * Default implementation of each callback ignores the event, so a
+    * handler only needs to override the callbacks it is interested in.
+    *
+    * A handler can also receive any subtree (e.g., each row of a large
+    * array) as a complete JSON object: captureValue() is called before reading
+    * every value, and if it returns true, the whole value is read into a JSON
+    * object (using the regular parser), and passed to onValue() instead of
+    * being reported as events.
+    */
+  class JSONHandler {
   public:
-    int64_t val;
-
-    Integer() {}
-    Integer(const int64_t &v): val(v) {}
-    void write(std::ostream &out) const { out << val; }
-    JSONValue type() const { return JSON_INTEGER; }
-    size_t returnAsArrayIndex() const { return static_cast<size_t>(val);}
-    Value* returnMyNewCopy() const { return new Integer(*this); }
-    operator const Value* () { return this; }
-    bool isEqual(const Value *other) const;
-    bool operator ==(const Integer& other) const { return isEqual(&other); }
-    bool operator !=(const Integer &other) const { return !(*this == other); }
-
-    // read() Should not be called for Integer and Real,
-    // use ReadNumberValue() instead for these two "special" classes
-    void read(std::istream &in __attribute__ ((unused)) ) { assert(false); }
+    virtual ~JSONHandler() {}
+
+    virtual void onStartObject() {}
+    /** Called for every key of an object (followed by events for the value) */
+    virtual void onKey(const std::string &) {}
+    virtual void onEndObject() {}
+    virtual void onStartArray() {}
+    virtual void onEndArray() {}
+    virtual void onString(const std::string &) {}
+    /** Called for a JSON_INTEGER value */
+    virtual void onInt64(int64_t) {}
+    /** Called for a JSON_REAL value */
+    virtual void onDouble(double) {}
+    virtual void onBoolean(bool) {}
+    virtual void onNull() {}
+
+    /** Called before reading each value.
+      * @param depth Number of arrays/objects enclosing the value (0 for top level value)
+      * @return true if the value should be read as a whole, and passed to onValue()
+      */
+    virtual bool captureValue(size_t /* depth */) { return false; }
+
+    /** Receives a value for which captureValue() returned true. The handler
+      * is free to modify it (e.g., move it somewhere else).
+      */
+    virtual void onValue(JSON &) {}
   };
 
-  class Real: public Value {
+  /** An incremental (push) parser: serialized JSON is fed to it in arbitrary
+    * fragments (e.g., as they are received from network), and each fragment is
+    * parsed right away, so parsing finishes soon after the last fragment arrives,
+    * and the serialized input never has to be held in memory as a whole.
+    * The value is either built as a JSON object (see value()), or reported to a
+    * JSONHandler as a sequence of events (see JSON::readEvents()).
+    *
+    * @note Unlike JSON::readFromBuffer(), the input must contain exactly one
+    *       JSON value: anything other than whitespace after it is an error.
+    */
+  class JSONPushParser {
   public:
-    double val;
-
-    Real() {}
-    Real(const double &v) {
-      assertValidityOfNumericType(v);
-      val = v;
-    }
-    void write(std::ostream &out) const { out << val; }
-    JSONValue type() const { return JSON_REAL; }
-    size_t returnAsArrayIndex() const { return static_cast<size_t>(val);}
-    Value* returnMyNewCopy() const { return new Real(*this); }
-    bool isEqual(const Value *other) const;
-    bool operator ==(const Real& other) const { return isEqual(&other); }
-    bool operator !=(const Real& other) const { return !(*this == other); }
-
-    // read() Should not be called for Integer and Real,
-    // use ReadNumberValue() instead for these two "special" classes
-    void read(std::istream &in __attribute__ ((unused)) ) { assert(false); }
+    /** Creates a parser which builds a JSON object (allocated from heap) */
+    JSONPushParser();
+
+    /** Creates a parser which builds a JSON object, allocated from the given
+      * arena (see JSONArena for caveats)
+      */
+    explicit JSONPushParser(JSONArena &arena);
+
+    /** Creates a parser which reports the value to a handler (values captured
+      * by the handler are allocated from heap)
+      */
+    explicit JSONPushParser(JSONHandler &handler);
+
+    ~JSONPushParser();
+
+    /** Parses next fragment of the input. A fragment can end anywhere
+      * (e.g., in the middle of a string or number); the data is not
+      * referenced after the call returns.
+      * @throw JSONException If input is not a valid JSON (the parser can not
+      *        be used any further, unless reset())
+      */
+    void feed(const char *data, size_t len);
+
+    /** Same as feed(const char*, size_t) */
+    void feed(const std::string &data) { feed(data.data(), data.size()); }
+
+    /** Signals the end of input.
+      * @throw JSONException If input ended before the JSON value was complete
+      */
+    void finish();
+
+    /** Returns true once finish() has been called successfully */
+    bool isFinished() const;
+
+    /** Returns the value read (only for parsers creating a JSON object).
+      * The value may be modified, or moved out of the parser.
+      * @throw JSONException If finish() has not been called successfully
+      */
+    JSON& value();
+
+    /** Discards all the state (and the value), so that a new input can be parsed */
+    void reset();
+
+  private:
+    JSON_Utility::PushParser *impl;
+
+    // Not copyable
+    JSONPushParser(const JSONPushParser &);
+    JSONPushParser& operator=(const JSONPushParser &);
   };
 
-  class String: public Value {
+  class LazyJSONDocument;
+  class JSONReader;
+
+  /** A value inside a LazyJSONDocument (see below). It's a lightweight handle
+    * (cheap to copy), which is only valid as long as the document it belongs to
+    * is not destroyed or assigned to. Accessors have the same semantics as the
+    * corresponding ones of JSON, but only look at (and convert) the bytes which
+    * are actually needed.
+    */
+  class LazyJSON {
   public:
-    std::string val;
+    /** Creates a JSON_UNDEFINED value (not belonging to any document) */
+    LazyJSON(): doc(NULL), pos(0) {}
 
-    String() {}
-    String(const std::string &v):val(v) {}
-    // TODO: Make sure cout << stl::string works as expected;
-    void write(std::ostream &out) const;
-    JSONValue type() const { return JSON_STRING; }
-    std::string returnString() const { return val; }
-    Value* returnMyNewCopy() const { return new String(*this); }
-    void read(std::istream &in);
-    bool isEqual(const Value *other) const;
-    bool operator ==(const String& other) const { return isEqual(&other); }
-    bool operator !=(const String& other) const { return !(*this == other); }
+    /** Returns type of the value (without converting it) */
+    JSONValue type() const;
+
+    /** Returns number of elements of a JSON_ARRAY, or keys of a JSON_OBJECT.
+      * @note Unlike JSON::size(), a key which appears more than once in the
+      *       object is counted every time.
+      * @throw JSONException If value is neither a JSON_ARRAY, nor a JSON_OBJECT
+      */
+    size_t size() const;
+
+    /** Exactly same as size() */
+    size_t length() const { return size(); }
+
+    /** Returns the value stored under the given key of a JSON_OBJECT. Takes time
+      * linear in number of keys of the object (the nested values are skipped
+      * without being looked at).
+      * @throw JSONException If key does not exist, or value is not a JSON_OBJECT
+      */
+    LazyJSON operator [](const std::string &key) const;
+
+    /** Same as operator[](const std::string&) */
+    LazyJSON operator [](const char *key) const { return (*this)[std::string(key)]; }
+
+    /** Returns the element at given index of a JSON_ARRAY. Takes time linear in
+      * the index: for visiting all elements of a large array, converting it with
+      * value() is usually faster.
+      * @throw JSONException If index is out of bounds, or value is not a JSON_ARRAY
+      */
+    LazyJSON operator [](const size_t &indx) const;
+
+    /** Same as operator[](const size_t&), for any numeric type */
+    template<typename T>
+    LazyJSON operator [](const T &x) const { return (*this)[static_cast<size_t>(x)]; }
+
+    /** Returns true if a JSON_OBJECT has the given key
+      * @throw JSONException If value is not a JSON_OBJECT
+      */
+    bool has(const std::string &key) const;
+
+    /** Same as has(const std::string&) */
+    bool has(const char *key) const { return has(std::string(key)); }
+
+    /** Returns true if the given index is valid for a JSON_ARRAY
+      * @throw JSONException If value is not a JSON_ARRAY
+      */
+    bool has(const size_t &indx) const;
 
-    // Should have a constructor which allows creation from std::string directly.
+    /** Same as has(const size_t&), for any numeric type */
+    template<typename T>
+    bool has(const T &indx) const { return has(static_cast<size_t>(indx)); }
+
+    /** Converts the value to a JSON object (allocated from heap) */
+    JSON value() const;
+
+    /** Converts the value to a JSON object, allocated from the given arena
+      * (see JSONArena for caveats)
+      */
+    JSON value(JSONArena &arena) const;
+
+    /** Same as JSON::get(): only the value itself is converted.
+      * @throw JSONException If no conversion to required type is possible
+      */
+    template<typename T>
+    T get() const {
+      return value().get<T>();
+    }
+
+    /** Returns the serialized value, exactly as it appears in the document */
+    std::string toString() const;
+
+  private:
+    friend class LazyJSONDocument;
+    friend class JSONReader;
+    friend class JSONPath;
+
+    const LazyJSONDocument *doc;
+    uint32_t pos; // Offset of the first character of the value in document
+
+    LazyJSON(const LazyJSONDocument *d, uint32_t p): doc(d), pos(p) {}
+
+    // Returns pointer to the value stored under "key" (or NULL if not found)
+    const char* find(const std::string &key) const;
+    // Returns pointer to element "indx" of array (or NULL if out of bounds)
+    const char* at(size_t indx) const;
+    // Returns pointer to the first character of the value
+    const char* valueBegin() const;
+    // Returns pointer past the last character of the value
+    const char* valueEnd() const;
   };
 
-  class Object: public Value {
+  /** A serialized JSON value, which is validated and indexed once (when read),
+    * while it's members are only converted when accessed (see LazyJSON). This
+    * is much cheaper than JSON::parse() if only a small part of a large value
+    * is ever looked at, e.g., a few fields of a large API response: untouched
+    * values cost nothing beyond the serialized bytes (and 12 bytes for each
+    * array/object). The document keeps a copy of the serialized input.
+    *
+    * @note Like JSON::parse(), only the first JSON value in input is read.
+    */
+  class LazyJSONDocument {
   public:
-    std::map<std::string, JSON> val;
+    /** @internal Location of an array/object in the document */
+    struct Container {
+      uint32_t begin; // Offset of the opening bracket
+      uint32_t end; // Offset past the closing bracket
+      uint32_t size; // Number of elements/keys
+    };
+
+    /** Creates an empty document (root value is JSON_UNDEFINED) */
+    LazyJSONDocument(): rootPos(0) {}
+
+    /** Reads the serialized json value in "str" (which is moved into the document).
+      * @throw JSONException If input is not a valid JSON, or is larger than 4GB
+      */
+    explicit LazyJSONDocument(std::string &&str): rootPos(0) { read(std::move(str)); }
+
+    /** Reads (a copy of) the serialized json value in "str"
+      * @throw JSONException If input is not a valid JSON, or is larger than 4GB
+      */
+    explicit LazyJSONDocument(const std::string &str): rootPos(0) { read(std::string(str)); }
+
+    /** Reads (a copy of) the serialized json value in buffer [begin, end)
+      * @throw JSONException If input is not a valid JSON, or is larger than 4GB
+      */
+    LazyJSONDocument(const char *begin, const char *end): rootPos(0) { read(std::string(begin, end)); }
+
+    /** Replaces the document with the serialized json value in "str" (which is
+      * moved into the document). All the LazyJSON values of the document become
+      * invalid.
+      * @throw JSONException If input is not a valid JSON, or is larger than 4GB
+      *        (document is left empty)
+      */
+    void read(std::string &&str);
+
+    /** Returns the top level value */
+    LazyJSON root() const { return (buf.empty()) ? LazyJSON() : LazyJSON(this, rootPos); }
+
+    /** Same as root().type() */
+    JSONValue type() const { return root().type(); }
+
+    /** Same as root().size() */
+    size_t size() const { return root().size(); }
+
+    /** Same as root()[x] */
+    template<typename T>
+    LazyJSON operator [](const T &x) const { return root()[x]; }
+
+    /** Same as root().has(x) */
+    template<typename T>
+    bool has(const T &x) const { return root().has(x); }
+
+    /** Same as root().value() */
+    JSON value() const { return root().value(); }
+
+  private:
+    friend class LazyJSON;
+
+    std::string buf;
+    std::vector<Container> containers; // Sorted by "begin"
+    uint32_t rootPos;
+
+    // Returns the array/object starting at "offset"
+    const Container& container(uint32_t offset) const;
+  };
+
+  /** A pull reader: a serialized json value is read piece by piece, in the
+    * order requested by the caller, without building a JSON object for it
+    * (see json_binding.h, which uses it for decoding json directly into C++
+    * types). E.g., the object {"a": [1, 2]} can be read as:
+    * @code
+    *   JSONReader r(str);
+    *   std::string key;
+    *   JSON num;
+    *   r.startObject();
+    *   while (r.nextKey(key)) {
+    *     if (key != "a") { r.skipValue(); continue; }
+    *     r.startArray();
+    *     while (r.nextElement())
+    *       r.readValue(num);
+    *   }
+    * @endcode
+    * The reader does not copy the input, so the buffer must outlive it.
+    * All functions throw JSONException if the input is not a valid json,
+    * or the next value is not of the requested type (the reader can not be
+    * used any further in that case).
+    */
+  class JSONReader {
+  public:
+    /** Reads the json value stored in buffer [begin, end) */
+    JSONReader(const char *begin, const char *end);
+
+    /** Reads the json value stored in a string */
+    explicit JSONReader(const std::string &str);
+
+    /** Reads a value of a LazyJSONDocument (in place) */
+    explicit JSONReader(const LazyJSON &v);
+
+    /** Reads the next value (of any type) as a whole. This allocates nothing
+      * for numbers, booleans, null and short strings, so it's also the way to
+      * read these.
+      */
+    void readValue(JSON &out);
+
+    /** Reads the next value, which must be a JSON_STRING, into "out" */
+    void readString(std::string &out);
+
+    /** Returns true, and skips over the next value, if it's null (nothing is
+      * read otherwise)
+      */
+    bool readNull();
+
+    /** Skips over the next value (of any type). The value is checked to be
+      * well formed, but (unlike other functions) escape sequences and UTF-8 in
+      * strings are not validated.
+      */
+    void skipValue();
+
+    /** Starts reading the next value, which must be a JSON_OBJECT: its members
+      * are then visited by calling nextKey() (followed by reading the value,
+      * or skipValue()) until it returns false.
+      */
+    void startObject();
+
+    /** Reads key of the next member of current object into "key".
+      * @return false if there are no more members (the object has been read completely)
+      */
+    bool nextKey(std::string &key);
+
+    /** Starts reading the next value, which must be a JSON_ARRAY: each element
+      * is read after a call to nextElement(), until it returns false.
+      */
+    void startArray();
+
+    /** Returns true if the current array has another element (which must be read,
+      * or skipped, next), or false if the array has been read completely.
+      */
+    bool nextElement();
+
+    /** Returns pointer to the first character after whatever has been read so far */
+    const char* position() const { return p; }
+
+  private:
+    const char *p;
+    const char *end;
+    bool first; // True if nothing has been read yet from the current array/object
+  };
+
+  // Examples of JSONPath expressions:
+  //   "/parts/*/md5"    md5 of every part (of a file description)
+  //   "/results/*/id"   id of every result (of a find query)
+  //   "/headers/*"      every value of the "headers" object
+  //   "/parts/1/state"  state of part "1"
+
+  /** A query for the values at a given path inside a json value, which is
+    * compiled once, and can then be evaluated (also concurrently) any number of
+    * times, against a JSON object, or directly against serialized json.
+    *
+    * The expression is a JSON Pointer (RFC 6901), in which a component "*"
+    * matches every member of an object, or element of an array (see examples
+    * above). A numeric component matches an element of an array, or a key of
+    * an object. As usual, "~1" stands for "/", and "~0" for "~" (a key which is
+    * just "*" can not be matched), and "" matches the value itself. Values are
+    * matched in document order.
+    */
+  class JSONPath {
+  public:
+    /** Compiles the expression
+      * @throw JSONException If the expression is not a valid JSON Pointer
+      */
+    explicit JSONPath(const std::string &expr);
+
+    /** Returns the expression this path was compiled from */
+    const std::string& expression() const { return expr; }
+
+    /** Appends pointers to all values matching the path inside "root" to "out"
+      * (they are valid as long as "root" is not modified).
+      */
+    void select(const JSON &root, std::vector<const JSON*> &out) const;
+
+    /** Returns the first value matching the path inside "root", or NULL if none does */
+    const JSON* find(const JSON &root) const;
+
+    /** Evaluates the path while reading the serialized json value stored in
+      * buffer [begin, end), appending the values matching the path to "out".
+      * Only the matching values are converted: everything else is skipped
+      * over (no strings are decoded, and nothing is allocated for it), which is
+      * much cheaper than parsing the whole value first.
+      * @note If an object has a duplicate key, each of its values is matched
+      *       (while JSON::parse() would only keep the last one).
+      * @return Pointer to the first character after the json value
+      * @throw JSONException If buffer does not contain a valid json value
+      */
+    const char* select(const char *begin, const char *end, std::vector<JSON> &out) const;
+
+    /** Same as select(const char*, const char*, std::vector<JSON>&), for a string */
+    void select(const std::string &str, std::vector<JSON> &out) const;
+
+    /** Same as select(const char*, const char*, std::vector<JSON>&), for a value
+      * of a LazyJSONDocument
+      */
+    void select(const LazyJSON &v, std::vector<JSON> &out) const;
+
+  private:
+    // A component of the path
+    struct Step {
+      std::string key;
+      size_t index; // Array index, if key is one (otherwise npos)
+      bool wildcard;
+    };
+
+    std::string expr;
+    std::vector<Step> steps;
+
+    // Evaluates steps [step, end) against "j"
+    void selectIn(const JSON &j, size_t step, std::vector<const JSON*> &out, bool firstOnly) const;
+    // Evaluates steps [step, end) against the serialized value starting at "p",
+    // returns pointer past the value
+    const char* selectIn(const char *p, const char *end, size_t step, std::vector<JSON> &out) const;
+  };
+
+  /** @internal Copy-on-write state of out-of-line storage of an array/object
+    * (see JSON::setCopyOnWrite()). Not copied along with the storage.
+    */
+  struct SharedState {
+    std::atomic<uint32_t> refs; // Number of JSON values sharing the storage
+    bool shareable; // Cleared once a non-const reference (or iterator) into the storage is handed out
+
+    SharedState(): refs(1), shareable(true) {}
+    SharedState(const SharedState&): refs(1), shareable(true) {}
+  };
+
+  /** @internal Out-of-line storage of a JSON_OBJECT value */
+  class Object {
+  public:
+    JSON::object_storage val;
+    SharedState shared;
 
     Object() { }
-    Object(const Object &rhs): val(rhs.val) {}
+    explicit Object(JSONArena *arena): val(JSON::object_storage::allocator_type(arena)) {}
+    Object(const Object &rhs): val(rhs.val.begin(), rhs.val.end()) {}
 
+    // Note: Keys of a std::map are already in sorted order
     template<typename T>
     Object(const std::map<std::string, T> &v) {
-      val.insert(v.begin(), v.end());
+      val.reserve(v.size());
+      for (typename std::map<std::string, T>::const_iterator it = v.begin(); it != v.end(); ++it)
+        val[it->first] = it->second;
     }
 
-    JSON& jsonAtKey(const std::string &s);
-    const JSON& jsonAtKey(const std::string &s) const;
-    void write(std::ostream &out) const;
-    JSONValue type() const { return JSON_OBJECT; }
-    Value* returnMyNewCopy() const { return new Object(*this); }
-    void read(std::istream &in);
-    void erase(const std::string &key);
-    bool isEqual(const Value *other) const;
-    bool operator ==(const Object& other) const { return isEqual(&other); }
-    bool operator !=(const Object& other) const { return !(*this == other); }
+    template<typename T>
+    Object(std::map<std::string, T> &&v) {
+      val.reserve(v.size());
+      for (typename std::map<std::string, T>::iterator it = v.begin(); it != v.end(); ++it)
+        val[it->first] = JSON(std::move(it->second));
+    }
   };
 
-  class Array: public Value {
+  /** @internal Out-of-line storage of a JSON_ARRAY value */
+  class Array {
   public:
-    std::vector<JSON> val;
+    JSON::array_storage val;
+    SharedState shared;
 
     Array() { }
-    Array(const Array& arr): val(arr.val) {}
+    explicit Array(JSONArena *arena): val(JSONArenaAllocator<JSON>(arena)) {}
+    Array(const Array& arr): val(arr.val.begin(), arr.val.end()) {}
 
     template<typename T>
     Array(const std::vector<T> &vec) {
+      val.reserve(vec.size());
       for (unsigned i = 0;i < vec.size(); i++) {
         JSON tmp(vec[i]);
-        val.push_back(tmp);
+        val.push_back(std::move(tmp));
       }
     }
 
-    const JSON& jsonAtIndex(size_t i) const;
-    void write(std::ostream &out) const;
-    JSONValue type() const { return JSON_ARRAY; }
-    Value* returnMyNewCopy() const { return new Array(*this); }
-    void read(std::istream &in);
-    void push_back(const JSON &j) {
-      val.push_back(j);
+    template<typename T>
+    Array(std::vector<T> &&vec) {
+      val.reserve(vec.size());
+      for (unsigned i = 0;i < vec.size(); i++)
+        val.push_back(JSON(std::move(vec[i])));
     }
-    void erase(const size_t &i);
-    bool isEqual(const Value* other) const;
-    bool operator ==(const Array& other) const { return isEqual(&other); }
-    bool operator !=(const Array& other) const { return !(*this == other); }
-
-  };
-
-  class Boolean: public Value {
-  public:
-    bool val;
-
-    Boolean() {}
-    Boolean(const bool &v):val(v) {}
-    JSON& jsonAtKey(const std::string &s);
-    const JSON& jsonAtKey(const std::string &s) const;
-    JSONValue type() const { return JSON_BOOLEAN; }
-    void write(std::ostream &out) const { out << ((val) ? "true" : "false"); }
-    Value* returnMyNewCopy() const { return new Boolean(*this); }
-    void read(std::istream &in);
-    bool isEqual(const Value* other) const;
-    bool operator ==(const Boolean& other) const { return isEqual(&other); }
-    bool operator !=(const Boolean& other) const { return !(*this == other); }
-  };
-
-  class Null: public Value {
-  public:
-    void write(std::ostream &out) const { out << "null"; }
-    JSONValue type() const { return JSON_NULL; }
-    Value* returnMyNewCopy() const { return new Null(*this); }
-    void read(std::istream &in);
-    bool isEqual(const Value* other) const;
-    bool operator ==(const Null& other) const { return isEqual(&other); }
-    bool operator !=(const Null& other) const { return !(*this == other); }
-
   };
 
   template<typename T>
-  JSON::JSON(const T& x) {
-    val = NULL; // So that clear() works fine on this, else we will be deallocating some arbitrary memory - dangerous!
-    *this = operator=(x);
+  JSON::JSON(const T& x): len(0), tag(JSON_UNDEFINED) {
+    operator=(x);
   }
 
 
@@ -771,24 +1789,49 @@ namespace dx {
       assertValidityOfNumericType(x);
 
     clear();
-    if(std::numeric_limits<T>::is_integer)
-      this->val = new Integer(static_cast<int64_t>(x));
-    else
-      this->val = new Real(static_cast<double>(x));
+    if(std::numeric_limits<T>::is_integer) {
+      val.i = static_cast<int64_t>(x);
+      tag = JSON_INTEGER;
+    } else {
+      val.d = static_cast<double>(x);
+      tag = JSON_REAL;
+    }
     return *this;
   }
 
   template<typename T>
   JSON& JSON::operator =(const std::vector<T> &vec) {
+    Array *a = new Array(vec);
+    clear();
+    val.arr = a;
+    tag = JSON_ARRAY;
+    return *this;
+  }
+
+  template<typename T>
+  JSON& JSON::operator =(std::vector<T> &&vec) {
+    Array *a = new Array(std::move(vec));
     clear();
-    this->val = new Array(vec);
+    val.arr = a;
+    tag = JSON_ARRAY;
     return *this;
   }
 
   template<typename T>
   JSON& JSON::operator =(const std::map<std::string, T> &m) {
+    Object *o = new Object(m);
     clear();
-    this->val = new Object(m);
+    val.obj = o;
+    tag = JSON_OBJECT;
+    return *this;
+  }
+
+  template<typename T>
+  JSON& JSON::operator =(std::map<std::string, T> &&m) {
+    Object *o = new Object(std::move(m));
+    clear();
+    val.obj = o;
+    tag = JSON_OBJECT;
     return *this;
   }
 
@@ -803,15 +1846,20 @@ namespace dx {
 
     switch(typ) {
       case JSON_INTEGER:
-        return static_cast<T>( ((Integer*)this->val)->val);
+        return static_cast<T>(val.i);
       case JSON_REAL:
-        return static_cast<T>( ((Real*)this->val)->val);
+        return static_cast<T>(val.d);
       case JSON_BOOLEAN:
-        return static_cast<T>( ((Boolean*)this->val)->val);
+        return static_cast<T>(val.b);
       default: assert(false); // Should never happen (already checked at top)
     }
   }
 
+  /** Exchanges values of two JSON objects (no deep copy is made) */
+  inline void swap(JSON &a, JSON &b) noexcept {
+    a.swap(b);
+  }
+
   template<typename T>
   const JSON& JSON::operator [](const T&x) const {
     return (*(const_cast<const JSON*>(this)))[static_cast<size_t>(x)];
@@ -828,9 +1876,17 @@ namespace dx {
   inline std::string JSON::get<std::string>() const {
     if (this->type() != JSON_STRING)
       throw JSONException("You cannot use get<std::string>/get<char*> for a non JSON_STRING value");
-    return ((String*)this->val)->val;
+    return std::string(stringData(), stringSize());
   }
 
 }
 
+namespace std {
+  /** Allows dx::JSON to be used as a key of std::unordered_map (see JSON::hash()) */
+  template<>
+  struct hash<dx::JSON> {
+    size_t operator()(const dx::JSON &j) const { return static_cast<size_t>(j.hash()); }
+  };
+}
+
 #endif
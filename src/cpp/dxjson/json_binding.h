@@ -0,0 +1,233 @@
+// Copyright (C) 2013-2016 DNAnexus, Inc.
+//
+// This file is part of dx-toolkit (DNAnexus platform client libraries).
+//
+//   Licensed under the Apache License, Version 2.0 (the "License"); you may
+//   not use this file except in compliance with the License. You may obtain a
+//   copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+//   WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+//   License for the specific language governing permissions and limitations
+//   under the License.
+
+#ifndef __DXJSON_JSON_BINDING_H__
+#define __DXJSON_JSON_BINDING_H__
+
+// Typed binding between serialized json and plain C++ types: values are
+// decoded directly from the input (using a JSONReader) into structs, strings,
+// numbers, std::vector and std::map, without building (and walking) a JSON
+// object first. Encoding goes straight to a string buffer, e.g., for building
+// request bodies.
+//
+// Fields of a struct are declared once, with DX_JSON_FIELDS() (which must be
+// used at global scope, after the struct is defined):
+//
+//   struct FilePart {
+//     std::string state;
+//     int64_t size;
+//     FilePart(): size(0) {}
+//   };
+//   DX_JSON_FIELDS(FilePart, state, size)
+//
+//   struct FileDescription {
+//     std::string id, state;
+//     std::map<std::string, FilePart> parts;
+//   };
+//   DX_JSON_FIELDS(FileDescription, id, state, parts)
+//
+//   FileDescription desc;
+//   dx::fromJSON(responseText, desc);
+//   std::string body = dx::toJSONString(desc);
+//
+// When decoding a struct, members not listed in DX_JSON_FIELDS() are skipped,
+// and fields which are missing (or null) in the input keep their value (so
+// a default constructor can provide defaults), except for fields of type
+// dx::JSON, which are set to JSON_NULL in the latter case. If a key occurs
+// more than once, the last occurrence wins. Numbers (and booleans) are
+// converted the same way as by JSON::get<T>().
+//
+// Other types can be supported by specializing dx::JSONBinding<T>.
+
+#include "dxjson.h"
+#include <boost/preprocessor/control/expr_if.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/preprocessor/seq/for_each_i.hpp>
+#include <boost/preprocessor/variadic/to_seq.hpp>
+#include <type_traits>
+
+namespace dx {
+
+  /** Decoding/encoding of values of type T: specializations provide
+    * static void read(JSONReader &r, T &v), which reads the next value of "r"
+    * into "v", and static void write(const T &v, std::string &out), which
+    * appends serialized "v" to "out".
+    */
+  template<typename T, typename Enable = void>
+  struct JSONBinding;
+
+  /** Decodes the next value of "r" into "v" */
+  template<typename T>
+  void fromJSON(JSONReader &r, T &v) {
+    JSONBinding<T>::read(r, v);
+  }
+
+  /** Decodes the serialized json value stored in buffer [begin, end) into "v"
+    * @throw JSONException If input is not a valid json, or does not match type T
+    */
+  template<typename T>
+  void fromJSON(const char *begin, const char *end, T &v) {
+    JSONReader r(begin, end);
+    JSONBinding<T>::read(r, v);
+  }
+
+  /** Decodes the serialized json value stored in a string into "v" */
+  template<typename T>
+  void fromJSON(const std::string &str, T &v) {
+    fromJSON(str.data(), str.data() + str.size(), v);
+  }
+
+  /** Decodes a value of a LazyJSONDocument into "v" */
+  template<typename T>
+  void fromJSON(const LazyJSON &lazy, T &v) {
+    JSONReader r(lazy);
+    JSONBinding<T>::read(r, v);
+  }
+
+  /** Appends serialized "v" to "out" */
+  template<typename T>
+  void toJSON(const T &v, std::string &out) {
+    JSONBinding<T>::write(v, out);
+  }
+
+  /** Returns serialized "v" */
+  template<typename T>
+  std::string toJSONString(const T &v) {
+    std::string out;
+    JSONBinding<T>::write(v, out);
+    return out;
+  }
+
+  template<>
+  struct JSONBinding<std::string> {
+    static void read(JSONReader &r, std::string &v) { r.readString(v); }
+    static void write(const std::string &v, std::string &out) { JSON::writeString(v, out); }
+  };
+
+  template<>
+  struct JSONBinding<JSON> {
+    static void read(JSONReader &r, JSON &v) { r.readValue(v); }
+    static void write(const JSON &v, std::string &out) { v.writeTo(out); }
+  };
+
+  /** Numbers and booleans */
+  template<typename T>
+  struct JSONBinding<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+    static void read(JSONReader &r, T &v) {
+      JSON tmp;
+      r.readValue(tmp);
+      v = tmp.get<T>();
+    }
+    static void write(const T &v, std::string &out) { JSON(v).writeTo(out); }
+  };
+
+  template<typename T>
+  struct JSONBinding<std::vector<T> > {
+    static void read(JSONReader &r, std::vector<T> &v) {
+      v.clear();
+      r.startArray();
+      while (r.nextElement()) {
+        v.push_back(T());
+        JSONBinding<T>::read(r, v.back());
+      }
+    }
+    static void write(const std::vector<T> &v, std::string &out) {
+      out += '[';
+      for (size_t i = 0; i < v.size(); ++i) {
+        if (i != 0)
+          out += ',';
+        JSONBinding<T>::write(v[i], out);
+      }
+      out += ']';
+    }
+  };
+
+  template<typename T>
+  struct JSONBinding<std::map<std::string, T> > {
+    static void read(JSONReader &r, std::map<std::string, T> &v) {
+      v.clear();
+      std::string key;
+      r.startObject();
+      while (r.nextKey(key)) {
+        T &slot = v[key];
+        slot = T(); // In case of a duplicate key
+        JSONBinding<T>::read(r, slot);
+      }
+    }
+    static void write(const std::map<std::string, T> &v, std::string &out) {
+      out += '{';
+      for (typename std::map<std::string, T>::const_iterator it = v.begin(); it != v.end(); ++it) {
+        if (it != v.begin())
+          out += ',';
+        JSON::writeString(it->first, out);
+        out += ':';
+        JSONBinding<T>::write(it->second, out);
+      }
+      out += '}';
+    }
+  };
+}
+
+namespace JSON_Utility {
+  // Reads a field of a struct bound with DX_JSON_FIELDS() (null leaves it unchanged)
+  template<typename T>
+  void readField(dx::JSONReader &r, T &v) {
+    if (!r.readNull())
+      dx::JSONBinding<T>::read(r, v);
+  }
+
+  inline void readField(dx::JSONReader &r, dx::JSON &v) {
+    r.readValue(v);
+  }
+}
+
+// Implementation of DX_JSON_FIELDS()
+#define DX_JSON_READ_FIELD_(r, v, field) \
+  if (key == BOOST_PP_STRINGIZE(field)) { \
+    JSON_Utility::readField(reader, v.field); \
+    continue; \
+  }
+
+#define DX_JSON_WRITE_FIELD_(r, v, i, field) \
+  out.append(BOOST_PP_EXPR_IF(i, ",") "\"" BOOST_PP_STRINGIZE(field) "\":"); \
+  dx::toJSON(v.field, out);
+
+/** Defines dx::JSONBinding<Type> for a struct (or class) "Type", which is
+  * read from/written as a JSON_OBJECT with the listed (public) data members
+  * (see top of json_binding.h). Must be used at global scope.
+  */
+#define DX_JSON_FIELDS(Type, ...) \
+  namespace dx { \
+    template<> \
+    struct JSONBinding<Type> { \
+      static void read(JSONReader &reader, Type &v) { \
+        std::string key; \
+        reader.startObject(); \
+        while (reader.nextKey(key)) { \
+          BOOST_PP_SEQ_FOR_EACH(DX_JSON_READ_FIELD_, v, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__)) \
+          reader.skipValue(); \
+        } \
+      } \
+      static void write(const Type &v, std::string &out) { \
+        out += '{'; \
+        BOOST_PP_SEQ_FOR_EACH_I(DX_JSON_WRITE_FIELD_, v, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__)) \
+        out += '}'; \
+      } \
+    }; \
+  }
+
+#endif
@@ -0,0 +1,71 @@
+// Copyright (C) 2013-2016 DNAnexus, Inc.
+//
+// This file is part of dx-toolkit (DNAnexus platform client libraries).
+//
+//   Licensed under the Apache License, Version 2.0 (the "License"); you may
+//   not use this file except in compliance with the License. You may obtain a
+//   copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+//   WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+//   License for the specific language governing permissions and limitations
+//   under the License.
+
+#ifndef __DXJSON_NUMBER_CODEC_H__
+#define __DXJSON_NUMBER_CODEC_H__
+
+// Internal header (not part of the public dxjson API).
+//
+// Conversion of JSON numbers from/to text, without going through
+// iostreams or the C library (except for rare corner cases):
+//  - parseNumber() validates and converts a number in a single pass. Reals
+//    are converted exactly (correctly rounded) using the Clinger fast path,
+//    or the Eisel-Lemire algorithm, and strtod() is only used for inputs which
+//    these cannot decide (e.g., more than 19 significant digits).
+//  - formatDouble() writes the shortest representation which reads back to
+//    exactly the same double (Schubfach algorithm), in the same format as
+//    ECMAScript's Number.prototype.toString() (e.g., 0.1, 1e+21, 1.5e-7).
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace JSON_Utility {
+
+  /** Result of parseNumber(): either an integer (isDouble == false),
+    * or a real value.
+    */
+  struct ParsedNumber {
+    bool isDouble;
+    int64_t i;
+    double d;
+  };
+
+  /** Parses the JSON number starting at "begin" (not going beyond "end").
+    * A number is considered to be a JSON_REAL if it contains a fraction or
+    * an exponent; integers not fitting in int64_t are clamped (as done by strtoll()),
+    * and so are reals not fitting in a double (to +/- DBL_MAX).
+    * @return Pointer past the last character of the number, or NULL if
+    *         the input does not start with a valid JSON number (this includes
+    *         numbers immediately followed by one of: digit, '+', '-', '.', 'e', 'E').
+    */
+  const char* parseNumber(const char *begin, const char *end, ParsedNumber &out);
+
+  /** Maximum number of characters written by formatInteger()/formatDouble() */
+  const size_t MAX_NUMBER_LENGTH = 32;
+
+  /** Writes the decimal representation of "v" to "buf" (not NULL terminated).
+    * @return Number of characters written
+    */
+  size_t formatInteger(int64_t v, char *buf);
+
+  /** Writes the shortest representation of a finite double "v" which reads back
+    * as exactly "v" to "buf" (not NULL terminated). "v" must not be NaN or Infinity.
+    * @return Number of characters written
+    */
+  size_t formatDouble(double v, char *buf);
+}
+
+#endif
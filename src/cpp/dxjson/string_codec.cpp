@@ -0,0 +1,244 @@
+// Copyright (C) 2013-2016 DNAnexus, Inc.
+//
+// This file is part of dx-toolkit (DNAnexus platform client libraries).
+//
+//   Licensed under the Apache License, Version 2.0 (the "License"); you may
+//   not use this file except in compliance with the License. You may obtain a
+//   copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+//   WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+//   License for the specific language governing permissions and limitations
+//   under the License.
+
+#include "string_codec.h"
+#include <cstring>
+#include <stdint.h>
+
+// SSE2 is always present on x86-64 (can be disabled by defining DXJSON_NO_SIMD)
+#if !defined(DXJSON_NO_SIMD) && defined(__x86_64__)
+  #define DXJSON_X86_SIMD 1
+  #include <emmintrin.h>
+#endif
+
+namespace JSON_Utility {
+
+  const char* findStringEnd(const char *p, const char *end) {
+    while (true) {
+#ifdef DXJSON_X86_SIMD
+      // Skip 16 bytes at a time, until a quote or a backslash is found
+      const __m128i quote = _mm_set1_epi8('"'), backslash = _mm_set1_epi8('\\');
+      while (end - p >= 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)));
+        if (mask != 0) {
+          p += __builtin_ctz(mask);
+          break;
+        }
+        p += 16;
+      }
+#endif
+      while (p != end && *p != '"' && *p != '\\')
+        ++p;
+      if (p == end)
+        return NULL;
+      if (*p == '"')
+        return p;
+      // Skip the backslash, and the character escaped by it
+      if (end - p < 2)
+        return NULL;
+      p += 2;
+    }
+  }
+
+  // Returns length of the valid UTF-8 sequence starting at "p" (with a non-ASCII
+  // first byte), or 0 if it's invalid (overlong forms, surrogates, and code points
+  // above U+10FFFF are invalid, same as for utf8::is_valid()).
+  static inline size_t validUtf8Sequence(const unsigned char *p, const unsigned char *end) {
+    const size_t avail = end - p;
+    const unsigned char c = p[0];
+    size_t len;
+    unsigned char lo = 0x80, hi = 0xBF; // Allowed range for the second byte
+    if (c >= 0xC2 && c <= 0xDF) {
+      len = 2;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+      len = 3;
+      if (c == 0xE0)
+        lo = 0xA0;
+      else if (c == 0xED)
+        hi = 0x9F;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+      len = 4;
+      if (c == 0xF0)
+        lo = 0x90;
+      else if (c == 0xF4)
+        hi = 0x8F;
+    } else {
+      return 0;
+    }
+    if (avail < len || p[1] < lo || p[1] > hi)
+      return 0;
+    for (size_t i = 2; i < len; ++i) {
+      if ((p[i] & 0xC0) != 0x80)
+        return 0;
+    }
+    return len;
+  }
+
+  static inline int hexValue(char ch) {
+    if (ch >= '0' && ch <= '9')
+      return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+      return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F')
+      return ch - 'A' + 10;
+    return -1;
+  }
+
+  // Reads the 4 hex digits at "p" (or returns -1 if they are not valid)
+  static inline int32_t readHex4(const char *p) {
+    int32_t v = 0;
+    for (int i = 0; i < 4; ++i) {
+      const int d = hexValue(p[i]);
+      if (d < 0)
+        return -1;
+      v = (v << 4) | d;
+    }
+    return v;
+  }
+
+  static inline char* appendUtf8(uint32_t cp, char *out) {
+    if (cp < 0x80) {
+      *out++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+      *out++ = static_cast<char>(0xC0 | (cp >> 6));
+      *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+      *out++ = static_cast<char>(0xE0 | (cp >> 12));
+      *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+      *out++ = static_cast<char>(0xF0 | (cp >> 18));
+      *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+      *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return out;
+  }
+
+  // Decodes the escape sequence at "p" (which points to the backslash) to "out".
+  // Returns false if it's not a legal escape sequence (or a lone surrogate).
+  // Note: Output of an escape sequence is never longer than the sequence itself
+  static inline bool unescape(const char *&p, const char *end, char *&out) {
+    if (end - p < 2)
+      return false;
+    switch (p[1]) {
+      case '"':  *out++ = '"'; break;
+      case '\\': *out++ = '\\'; break;
+      case '/':  *out++ = '/'; break;
+      case 'b':  *out++ = '\b'; break;
+      case 'f':  *out++ = '\f'; break;
+      case 'n':  *out++ = '\n'; break;
+      case 'r':  *out++ = '\r'; break;
+      case 't':  *out++ = '\t'; break;
+      case 'u': {
+        if (end - p < 6)
+          return false;
+        int32_t cp = readHex4(p + 2);
+        if (cp < 0 || (cp >= 0xDC00 && cp <= 0xDFFF))
+          return false;
+        if (cp >= 0xD800 && cp <= 0xDBFF) {
+          // Must be followed by the second half of a surrogate pair
+          if (end - p < 12 || p[6] != '\\' || p[7] != 'u')
+            return false;
+          const int32_t low = readHex4(p + 8);
+          if (low < 0xDC00 || low > 0xDFFF)
+            return false;
+          cp = ((cp - 0xD800) << 10) + (low - 0xDC00) + 0x10000;
+          p += 6;
+        }
+        out = appendUtf8(static_cast<uint32_t>(cp), out);
+        p += 6;
+        return true;
+      }
+      default:
+        return false;
+    }
+    p += 2;
+    return true;
+  }
+
+  size_t unescapeString(const char *begin, const char *end, char *dst) {
+    const char *p = begin;
+    char *out = dst;
+    // Invariant: (out - dst) <= (p - begin), since no decoded sequence is longer
+    // than it's raw form. So a full 16 byte block always fits in "dst".
+    while (p != end) {
+#ifdef DXJSON_X86_SIMD
+      const __m128i backslash = _mm_set1_epi8('\\');
+      while (end - p >= 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        // High bit of a byte is set for non-ASCII characters
+        const int mask = _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, backslash)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+        if (mask != 0) {
+          const int n = __builtin_ctz(mask);
+          p += n;
+          out += n;
+          break;
+        }
+        p += 16;
+        out += 16;
+      }
+#endif
+      // Copy the run of plain ASCII characters in one go
+      const char *run = p;
+      while (p != end && static_cast<unsigned char>(*p) < 0x80 && *p != '\\')
+        ++p;
+      if (p != run) {
+        memcpy(out, run, p - run);
+        out += p - run;
+      }
+      if (p == end)
+        break;
+
+      if (*p == '\\') {
+        if (!unescape(p, end, out))
+          return UNESCAPE_FAILED;
+      } else {
+        const size_t len = validUtf8Sequence(reinterpret_cast<const unsigned char*>(p), reinterpret_cast<const unsigned char*>(end));
+        if (len == 0)
+          return UNESCAPE_FAILED;
+        memcpy(out, p, len);
+        p += len;
+        out += len;
+      }
+    }
+    return out - dst;
+  }
+
+  const char* findCharToEscape(const char *p, const char *end) {
+#ifdef DXJSON_X86_SIMD
+    // Note: c <= 0x1F (unsigned) iff max(c, 0x1F) == 0x1F
+    const __m128i quote = _mm_set1_epi8('"'), backslash = _mm_set1_epi8('\\'), ctrl = _mm_set1_epi8(0x1F);
+    while (end - p >= 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                           _mm_cmpeq_epi8(_mm_max_epu8(v, ctrl), ctrl));
+      const int mask = _mm_movemask_epi8(special);
+      if (mask != 0)
+        return p + __builtin_ctz(mask);
+      p += 16;
+    }
+#endif
+    for (; p != end; ++p) {
+      const unsigned char c = static_cast<unsigned char>(*p);
+      if (c == '"' || c == '\\' || c < 0x20)
+        return p;
+    }
+    return end;
+  }
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2013-2016 DNAnexus, Inc.
+//
+// This file is part of dx-toolkit (DNAnexus platform client libraries).
+//
+//   Licensed under the Apache License, Version 2.0 (the "License"); you may
+//   not use this file except in compliance with the License. You may obtain a
+//   copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+//   WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+//   License for the specific language governing permissions and limitations
+//   under the License.
+
+#ifndef __DXJSON_STRING_CODEC_H__
+#define __DXJSON_STRING_CODEC_H__
+
+// Internal header (not part of the public dxjson API).
+//
+// Fast path for reading JSON strings: the raw characters of a string are
+// unescaped, and checked to be valid UTF-8, in a single pass which writes
+// directly to the final storage of the string. Runs of plain ASCII
+// characters are processed 16 bytes at a time (using SSE2 when available).
+//
+// Anything unusual (invalid UTF-8, or an illegal escape sequence) is left to
+// the (slower) reference implementation in dxjson.cpp, which replaces
+// invalid UTF-8, and reports errors.
+//
+// For writing, findCharToEscape() lets the serializer copy runs of characters
+// which need no escaping in bulk.
+
+#include <cstddef>
+
+namespace JSON_Utility {
+
+  /** Returns pointer to the closing quote of a string, whose first character
+    * (just after the opening quote) is at "p", or NULL if the string does not end
+    * before "end".
+    */
+  const char* findStringEnd(const char *p, const char *end);
+
+  /** Returned by unescapeString() if the fast path can not decode the string */
+  const size_t UNESCAPE_FAILED = static_cast<size_t>(-1);
+
+  /** Decodes the raw characters [begin, end) of a JSON string (i.e., between
+    * the quotes) to "dst", which must have room for (end - begin) bytes: escape
+    * sequences are resolved, and the result is checked to be valid UTF-8.
+    * @return Number of bytes written to "dst", or UNESCAPE_FAILED if the input
+    *         contains invalid UTF-8, or an illegal escape sequence (contents of
+    *         "dst" are unspecified in that case).
+    */
+  size_t unescapeString(const char *begin, const char *end, char *dst);
+
+  /** Returns pointer to the first character in [p, end) which must be escaped
+    * in a serialized JSON string (double quote, backslash, or a control
+    * character U+0000 - U+001F), or "end" if there is no such character.
+    */
+  const char* findCharToEscape(const char *p, const char *end);
+}
+
+#endif
@@ -0,0 +1,114 @@
+// Copyright (C) 2013-2016 DNAnexus, Inc.
+//
+// This file is part of dx-toolkit (DNAnexus platform client libraries).
+//
+//   Licensed under the Apache License, Version 2.0 (the "License"); you may
+//   not use this file except in compliance with the License. You may obtain a
+//   copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+//   WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+//   License for the specific language governing permissions and limitations
+//   under the License.
+
+#include "mapped_file.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#if !WINDOWS_BUILD
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace dx {
+
+  MappedFile::MappedFile(const std::string &path): data(NULL), len(0), mapped(false), skip(0) {
+    if (!open(path))
+      throw std::runtime_error("Unable to open file: '" + path + "'");
+  }
+
+  bool MappedFile::open(const std::string &path) {
+    return open(path, 0, std::numeric_limits<size_t>::max());
+  }
+
+  bool MappedFile::open(const std::string &path, uint64_t offset, size_t length) {
+    close();
+#if !WINDOWS_BUILD
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && static_cast<uint64_t>(st.st_size) > offset && length > 0) {
+      if (static_cast<uint64_t>(st.st_size) - offset < length)
+        length = static_cast<size_t>(static_cast<uint64_t>(st.st_size) - offset);
+      const size_t pageOffset = static_cast<size_t>(offset % static_cast<uint64_t>(sysconf(_SC_PAGESIZE)));
+      if (length <= std::numeric_limits<size_t>::max() - pageOffset) {
+        void *p = mmap(NULL, pageOffset + length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset - pageOffset));
+        if (p != MAP_FAILED) {
+          ::close(fd); // Mapping stays valid
+          data = static_cast<const char*>(p) + pageOffset;
+          len = length;
+          mapped = true;
+          skip = pageOffset;
+          return true;
+        }
+      }
+    }
+    ::close(fd);
+#endif
+    // Can not be mapped (e.g., a pipe, or an empty file): read the contents instead
+    std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+    if (!in.is_open())
+      return false;
+    if (offset > 0)
+      in.seekg(static_cast<std::streamoff>(offset));
+    if (length == std::numeric_limits<size_t>::max()) {
+      contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    } else {
+      // Read in blocks, since "length" can be much larger than the file
+      char buf[65536];
+      while (length > 0 && in.good()) {
+        in.read(buf, static_cast<std::streamsize>(std::min(length, sizeof(buf))));
+        contents.append(buf, static_cast<size_t>(in.gcount()));
+        length -= static_cast<size_t>(in.gcount());
+      }
+    }
+    if (in.bad())
+      throw std::runtime_error("An error occurred while reading file: '" + path + "'");
+    data = contents.data();
+    len = contents.size();
+    return true;
+  }
+
+  void MappedFile::close() {
+#if !WINDOWS_BUILD
+    if (mapped)
+      munmap(const_cast<char*>(data - skip), len + skip);
+#endif
+    std::string().swap(contents);
+    data = NULL;
+    len = 0;
+    mapped = false;
+    skip = 0;
+  }
+
+  void MappedFile::prefault() const {
+#if !WINDOWS_BUILD
+    if (!mapped)
+      return;
+    const char *base = data - skip;
+    madvise(const_cast<char*>(base), len + skip, MADV_WILLNEED);
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const volatile char *p = base;
+    for (size_t i = skip; i < len + skip; i += pageSize - (i % pageSize))
+      (void) p[i];
+#endif
+  }
+}
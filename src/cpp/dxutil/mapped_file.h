@@ -0,0 +1,96 @@
+// Copyright (C) 2013-2016 DNAnexus, Inc.
+//
+// This file is part of dx-toolkit (DNAnexus platform client libraries).
+//
+//   Licensed under the Apache License, Version 2.0 (the "License"); you may
+//   not use this file except in compliance with the License. You may obtain a
+//   copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+//   WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+//   License for the specific language governing permissions and limitations
+//   under the License.
+
+#ifndef __DXUTIL_MAPPED_FILE_H__
+#define __DXUTIL_MAPPED_FILE_H__
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+
+namespace dx {
+
+  /** Read-only contents of a file, which is memory mapped (where possible), so
+    * that it can be read in place without first copying it into a buffer:
+    * e.g., parsed with JSON::parse(), streamed with JSON::readEvents(),
+    * JSONReader or JSONPath::select() (which can then start processing the
+    * first values before the rest of the file has even been read from disk),
+    * or decoded with JSON::readBinary().
+    * A region of a file can be mapped as well (e.g., to send it as an HTTP
+    * request body).
+    * Files which can not be mapped (e.g., pipes), are read into memory instead.
+    * @note The file must not be truncated while it's mapped.
+    */
+  class MappedFile {
+  public:
+    /** Creates an empty (size() == 0) object */
+    MappedFile(): data(NULL), len(0), mapped(false), skip(0) {}
+
+    /** Maps the given file
+      * @throw std::runtime_error If the file can not be opened, or read
+      */
+    explicit MappedFile(const std::string &path);
+
+    ~MappedFile() { close(); }
+
+    /** Maps the given file (releasing the previous one)
+      * @return false if the file can not be opened (object is left empty)
+      * @throw std::runtime_error If an error occurs while reading the file
+      */
+    bool open(const std::string &path);
+
+    /** Maps at most "length" bytes of the given file, starting at byte "offset"
+      * (releasing the previous one). Fewer bytes are mapped if the file ends
+      * before offset + length.
+      * @return false if the file can not be opened (object is left empty)
+      * @throw std::runtime_error If an error occurs while reading the file
+      */
+    bool open(const std::string &path, uint64_t offset, size_t length);
+
+    /** Releases the file (object becomes empty) */
+    void close();
+
+    /** Reads the mapped contents into memory now (madvise(MADV_WILLNEED), and
+      * then touching every page), so that later accesses (e.g., from another
+      * thread) don't block on disk reads. Does nothing if the contents were
+      * not mapped (i.e., were read into memory already).
+      * @note Pages can still be evicted (and read again) under memory pressure.
+      */
+    void prefault() const;
+
+    /** Returns pointer to the first byte of the contents */
+    const char* begin() const { return data; }
+
+    /** Returns pointer past the last byte of the contents */
+    const char* end() const { return data + len; }
+
+    /** Returns size of the file (in bytes) */
+    size_t size() const { return len; }
+
+  private:
+    const char *data;
+    size_t len;
+    bool mapped; // False if contents were read into "contents"
+    size_t skip; // Bytes mapped before "data" (since mmap() offset must be page aligned)
+    std::string contents;
+
+    // Not copyable
+    MappedFile(const MappedFile&);
+    MappedFile& operator =(const MappedFile&);
+  };
+}
+
+#endif
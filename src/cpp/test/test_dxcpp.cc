@@ -252,6 +252,30 @@ TEST(DXHTTPRequestTest, retryLogicWithRetryAfter) {
   ASSERT_LE(localTimeElapsed, 16000);
 }
 
+TEST(DXHTTPRequestTest, Async) {
+  // Many requests in flight at once (made by a single background thread)
+  vector<future<JSON> > responses;
+  for (int i = 0; i < 20; i++)
+    responses.push_back(systemFindProjectsAsync(string("{\"limit\": 1}")));
+  for (unsigned i = 0; i < responses.size(); i++)
+    ASSERT_TRUE(responses[i].get().has("results"));
+
+  // Errors are reported as DXHTTPRequest() would have thrown them
+  future<JSON> bad = DXHTTPRequestAsync("/file-000000000000000000000000/describe", "{}");
+  ASSERT_THROW(bad.get(), DXAPIError);
+
+  // Callback is called on the background thread
+  promise<JSON> result;
+  DXHTTPRequestAsync("/system/findProjects", "{\"limit\": 1}", true, map<string, string>(),
+                     [&result](const JSON &response, exception_ptr error) {
+                       if (error)
+                         result.set_exception(error);
+                       else
+                         result.set_value(response);
+                     });
+  ASSERT_TRUE(result.get_future().get().has("results"));
+}
+
 ////////////
 // DXLink //
 ////////////
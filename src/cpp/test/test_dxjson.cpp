@@ -17,7 +17,13 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include "dxjson.h"
+#include "json_binding.h"
+#include "dxutil/mapped_file.h"
 #include <fstream>
+#include <set>
+#include <unordered_map>
+#include <thread>
+#include <unistd.h>
 using namespace std;
 using namespace dx;
 
@@ -829,6 +835,1115 @@ TEST(JSONTest, UnableToCreateKeysInConstJSON) {
   //j3_c[0] = 12;
 }
 
+TEST(JSONTest, ParseFromBuffer) {
+  const std::string str = "{\"a\": [1, 2.5, \"x\\ny\", true, null]} trailing";
+  JSON j1 = JSON::parse(str.data(), str.data() + str.size());
+  ASSERT_EQ(j1["a"].size(), 5);
+  ASSERT_EQ(j1["a"][0], 1);
+  ASSERT_EQ(j1["a"][1], 2.5);
+  ASSERT_EQ(j1["a"][2], "x\ny");
+  ASSERT_EQ(j1["a"][3], true);
+  ASSERT_EQ(j1["a"][4].type(), JSON_NULL);
+  ASSERT_EQ(j1, JSON::parse(str));
+
+  // readFromBuffer() returns pointer to first character after the value
+  JSON j2;
+  const char *stop = j2.readFromBuffer(str.data(), str.data() + str.size());
+  ASSERT_EQ(std::string(stop), " trailing");
+
+  // Buffer need not be NULL terminated
+  const char buf[] = {'[', '1', '2', '3', ']', '4', '5'};
+  ASSERT_EQ(JSON::parse(buf, buf + 5)[0], 123);
+  ASSERT_EQ(JSON::parse(buf + 1, buf + 3), 12);
+  ASSERT_JSONEXCEPTION(JSON::parse(buf, buf + 4));
+  ASSERT_JSONEXCEPTION(JSON::parse(str.data(), str.data() + 10));
+  ASSERT_JSONEXCEPTION(JSON::parse(buf, buf));
+
+  // istream version leaves the stream positioned after the value
+  std::stringstream in("[1, 2] {\"k\": \"v\"} 3");
+  JSON j3, j4;
+  j3.read(in);
+  j4.read(in);
+  ASSERT_EQ(j3.size(), 2);
+  ASSERT_EQ(j4["k"], "v");
+  int rest;
+  in >> rest;
+  ASSERT_EQ(rest, 3);
+}
+
+// Stream buffer which can not be repositioned, and which is filled one
+// character at a time (like that of std::cin, or of a pipe)
+class UnseekableBuf: public std::streambuf {
+public:
+  explicit UnseekableBuf(const std::string &data): data(data), pos(0), ch(0) {}
+protected:
+  int_type underflow() {
+    if (pos == data.size())
+      return traits_type::eof();
+    ch = data[pos++];
+    setg(&ch, &ch, &ch + 1);
+    return traits_type::to_int_type(ch);
+  }
+private:
+  std::string data;
+  size_t pos;
+  char ch;
+};
+
+TEST(JSONTest, ReadFromUnseekableStream) {
+  UnseekableBuf buf(" {\"a\": [1, \"x]}\\\"\"]} 42\ttrue\"s\" [[], {}]null-1.5e3,rest");
+  std::istream in(&buf);
+  ASSERT_EQ(in.tellg(), std::streampos(-1));
+  const char *expected[] = {"{\"a\":[1,\"x]}\\\"\"]}", "42", "true", "\"s\"", "[[],{}]", "null", "-1.5e3"};
+  for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+    JSON j;
+    j.read(in);
+    ASSERT_EQ(j, JSON::parse(expected[i])) << i;
+  }
+  // Nothing past the last value was consumed
+  std::string rest;
+  in >> rest;
+  ASSERT_EQ(rest, ",rest");
+  JSON j;
+  ASSERT_JSONEXCEPTION(j.read(in));
+}
+
+TEST(JSONTest, CompactRepresentation) {
+  ASSERT_EQ(sizeof(JSON), 16u);
+  // Strings upto 14 bytes are stored inline, longer ones out-of-line
+  const std::string s14 = "abcdefghijklmn", s15 = "abcdefghijklmno";
+  JSON j1 = s14, j2 = s15, j3 = std::string("a\0b", 3);
+  ASSERT_TRUE(j1.tag & JSON::STRING_INLINE);
+  ASSERT_FALSE(j2.tag & JSON::STRING_INLINE);
+  ASSERT_EQ(j1.get<std::string>(), s14);
+  ASSERT_EQ(j2.get<std::string>(), s15);
+  ASSERT_EQ(j3.size(), 3u);
+  ASSERT_EQ(j3.get<std::string>(), std::string("a\0b", 3));
+  ASSERT_NE(j1, j2);
+  ASSERT_EQ(JSON::parse("\"" + s15 + "\""), j2);
+  ASSERT_EQ(JSON(JSON_STRING).size(), 0u);
+
+  JSON j4(JSON_ARRAY);
+  j4.push_back(j1);
+  j4.push_back(j2);
+  j4.push_back(12);
+  j4.push_back(-1.5);
+  j4.push_back(true);
+  j4.push_back(JSON(JSON_NULL));
+  JSON j5 = j4;
+  ASSERT_EQ(j5, j4);
+  ASSERT_EQ(j5.toString(), "[\"abcdefghijklmn\",\"abcdefghijklmno\",12,-1.5,true,null]");
+  j5[1] = j5[0];
+  j5[0] = s15;
+  ASSERT_EQ(j5[0], j2);
+  ASSERT_EQ(j5[1], j1);
+
+  // Assigning a part of a value to itself
+  JSON j6 = JSON::parse("{\"a\": {\"b\": [1, \"a long string value\"]}}");
+  j6 = j6["a"]["b"];
+  ASSERT_EQ(j6.toString(), "[1,\"a long string value\"]");
+  j6 = j6[1];
+  ASSERT_EQ(j6, "a long string value");
+}
+
+TEST(JSONTest, Arena) {
+  const std::string str = "{\"a\": [1, 2.5, \"a string which is longer than sso\", true, null, {\"x\": {}}], \"b\": {\"c\": [[], \"d\"]}}";
+  JSON copy;
+  {
+    JSONArena arena(64);
+    JSON j1 = JSON::parse(str, arena);
+    ASSERT_GT(arena.capacity(), 0u);
+    ASSERT_TRUE(j1.tag & JSON::IN_ARENA);
+    ASSERT_TRUE(j1["a"][2].tag & JSON::IN_ARENA);
+    ASSERT_EQ(j1, JSON::parse(str));
+    ASSERT_EQ(j1["a"][2], "a string which is longer than sso");
+
+    // Copies are allocated on heap
+    copy = j1;
+    ASSERT_FALSE(copy.tag & JSON::IN_ARENA);
+    ASSERT_FALSE(copy["a"][2].tag & JSON::IN_ARENA);
+    JSON copy2(j1["b"]);
+    ASSERT_FALSE(copy2.tag & JSON::IN_ARENA);
+    ASSERT_EQ(copy2, j1["b"]);
+
+    // Arena allocated values can be modified freely
+    for (int i = 0; i < 1000; ++i)
+      j1["a"].push_back(i);
+    j1["b"]["c"][0] = JSON::parse(str);
+    j1["b"]["new"] = copy2;
+    j1["a"].erase(0);
+    j1["b"].erase("c");
+    ASSERT_EQ(j1["a"].size(), 1005);
+    ASSERT_EQ(j1["a"][1004], 999);
+    ASSERT_EQ(j1["b"]["new"], copy2);
+    j1.readFromBuffer(str.data(), str.data() + str.size(), arena);
+    ASSERT_EQ(j1, copy);
+
+    ASSERT_JSONEXCEPTION(JSON::parse("[1, 2, {\"a\": [3, 4", arena));
+    j1.clear();
+    arena.reset();
+    JSON j2 = JSON::parse(str, arena);
+    ASSERT_EQ(j2, copy);
+  }
+  // Copy outlives the arena
+  ASSERT_EQ(copy, JSON::parse(str));
+
+  // Swapping containers exchanges their allocators too
+  JSONArena arena;
+  std::vector<int, JSONArenaAllocator<int> > inArena((JSONArenaAllocator<int>(&arena))), onHeap;
+  inArena.push_back(1);
+  onHeap.push_back(2);
+  inArena.swap(onHeap);
+  ASSERT_EQ(inArena.get_allocator().arena, (JSONArena*) NULL);
+  ASSERT_EQ(onHeap.get_allocator().arena, &arena);
+  ASSERT_EQ(inArena[0], 2);
+  ASSERT_EQ(onHeap[0], 1);
+  inArena = std::move(onHeap);
+  ASSERT_EQ(inArena.get_allocator().arena, &arena);
+  ASSERT_EQ(inArena[0], 1);
+}
+
+TEST(JSONTest, MoveSemantics) {
+  const std::string longStr = "a string which is too long to be stored inline";
+  JSON j1 = JSON::parse("{\"a\": {\"b\": [1, \"" + longStr + "\"]}, \"c\": 12}");
+  const JSON orig = j1;
+
+  // Move construction does not copy the out-of-line storage
+  const char *data = j1["a"]["b"][1].stringData();
+  JSON j2(std::move(j1));
+  ASSERT_EQ(j1.type(), JSON_UNDEFINED);
+  ASSERT_EQ(j2, orig);
+  ASSERT_EQ(j2["a"]["b"][1].stringData(), data);
+
+  // Move assignment (including from a value inside the target)
+  j1 = std::move(j2);
+  ASSERT_EQ(j2.type(), JSON_UNDEFINED);
+  ASSERT_EQ(j1, orig);
+  j1 = std::move(j1["a"]["b"]);
+  ASSERT_EQ(j1, JSON::parse("[1, \"" + longStr + "\"]"));
+  ASSERT_EQ(j1[1].stringData(), data);
+  j1 = std::move(j1);
+  ASSERT_EQ(j1.size(), 2);
+
+  JSON j3 = "short";
+  swap(j1, j3);
+  ASSERT_EQ(j1, "short");
+  ASSERT_EQ(j3[1].stringData(), data);
+  j3.swap(j3);
+  ASSERT_EQ(j3.size(), 2);
+
+  // Growing an array moves (rather than copies) existing elements
+  JSON arr(JSON_ARRAY);
+  for (int i = 0; i < 100; ++i)
+    arr.push_back(JSON(longStr));
+  JSON str(longStr);
+  data = str.stringData();
+  arr.push_back(std::move(str));
+  ASSERT_EQ(str.type(), JSON_UNDEFINED);
+  for (int i = 0; i < 100; ++i)
+    arr.push_back(JSON(i));
+  ASSERT_EQ(arr[100].stringData(), data);
+  ASSERT_THROW(j1.push_back(JSON(1)), JSONException);
+
+  JSON obj(JSON_OBJECT);
+  JSON &inserted = obj.insert("x", std::move(arr));
+  ASSERT_EQ(arr.type(), JSON_UNDEFINED);
+  ASSERT_EQ(&inserted, &obj["x"]);
+  ASSERT_EQ(obj["x"][100].stringData(), data);
+  obj.insert("x", JSON(1));
+  ASSERT_EQ(obj["x"], 1);
+  ASSERT_THROW(j1.insert("x", JSON(1)), JSONException);
+
+  std::vector<JSON> vec(2, JSON(longStr));
+  data = vec[1].stringData();
+  JSON fromVec;
+  fromVec = std::move(vec);
+  ASSERT_EQ(fromVec[1].stringData(), data);
+  ASSERT_EQ(fromVec[0], longStr);
+
+  std::map<std::string, JSON> m;
+  m["k"] = JSON(longStr);
+  data = m["k"].stringData();
+  JSON fromMap;
+  fromMap = std::move(m);
+  ASSERT_EQ(fromMap["k"].stringData(), data);
+}
+
+TEST(JSONTest, NumberRoundTrip) {
+  ASSERT_EQ(JSON(0.1).toString(), "0.1");
+  ASSERT_EQ(JSON(2.0 / 3).toString(), "0.6666666666666666");
+  ASSERT_EQ(JSON(-1.5e-7).toString(), "-1.5e-7");
+  ASSERT_EQ(JSON(0.000001).toString(), "0.000001");
+  ASSERT_EQ(JSON(123456.789).toString(), "123456.789");
+  ASSERT_EQ(JSON(1e21).toString(), "1e+21");
+  ASSERT_EQ(JSON(5e-324).toString(), "5e-324");
+  ASSERT_EQ(JSON(1.7976931348623157e308).toString(), "1.7976931348623157e+308");
+  ASSERT_EQ(JSON(-0.0).toString(), "-0");
+  ASSERT_EQ(JSON(int64_t(-9223372036854775807LL - 1)).toString(), "-9223372036854775808");
+  ASSERT_EQ(JSON(int64_t(9223372036854775807LL)).toString(), "9223372036854775807");
+
+  // Large integral reals must not be read back as (overflowing) integers
+  JSON big = JSON::parse(JSON(1e19).toString());
+  ASSERT_EQ(big.type(), JSON_REAL);
+  ASSERT_EQ(double(big), 1e19);
+
+  // Every real value must be read back exactly (no epsilon)
+  srand(42);
+  for (int i = 0; i < 10000; ++i) {
+    uint64_t bits = (uint64_t(rand()) << 62) ^ (uint64_t(rand()) << 31) ^ uint64_t(rand());
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    if (boost::math::isnan(d) || boost::math::isinf(d))
+      continue;
+    JSON back = JSON::parse(JSON(d).toString());
+    double r = (back.type() == JSON_REAL) ? back.get<double>() : double(back.get<int64_t>());
+    ASSERT_EQ(memcmp(&r, &d, sizeof(d)), 0) << JSON(d).toString();
+  }
+
+  ASSERT_EQ(JSON::parse("9223372036854775807").get<int64_t>(), 9223372036854775807LL);
+  ASSERT_EQ(JSON::parse("-9223372036854775808").get<int64_t>(), -9223372036854775807LL - 1);
+  ASSERT_EQ(JSON::parse("123456789012345678901234").get<int64_t>(), 9223372036854775807LL);
+  ASSERT_EQ(JSON::parse("0.30000000000000004441").get<double>(), 0.30000000000000004441);
+  ASSERT_EQ(JSON::parse("2.2250738585072011e-308").get<double>(), 2.2250738585072011e-308);
+  ASSERT_EQ(JSON::parse("1e-400").get<double>(), 0.0);
+  // Reals out of range of double are clamped (JSON has no Infinity)
+  ASSERT_EQ(JSON::parse("1e400").get<double>(), std::numeric_limits<double>::max());
+  ASSERT_EQ(JSON::parse("-1e400").get<double>(), -std::numeric_limits<double>::max());
+  ASSERT_EQ(JSON::parse("1.8e308").get<double>(), std::numeric_limits<double>::max());
+  ASSERT_EQ(JSON::parse("123456789012345678901234567890e300").get<double>(), std::numeric_limits<double>::max());
+  ASSERT_EQ(JSON::parse("1e400").toString(), "1.7976931348623157e+308");
+  // Non-finite values are never written (even if stored in a JSON_REAL directly)
+  JSON inf(1.0);
+  inf.val.d = std::numeric_limits<double>::infinity();
+  ASSERT_JSONEXCEPTION(inf.toString());
+  inf.val.d = std::numeric_limits<double>::quiet_NaN();
+  JSON arr(JSON_ARRAY);
+  arr.push_back(inf);
+  ASSERT_JSONEXCEPTION(arr.toString());
+  ASSERT_EQ(JSON::parse("[1E+2]")[0].type(), JSON_REAL);
+  const char *invalid[] = {"-", "01", "1.", ".1", "1e", "1e+", "1.5.3", "1-2", "--1", "+1", "-01", "[1.e2]"};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+    ASSERT_THROW(JSON::parse(invalid[i]), JSONException) << invalid[i];
+}
+
+// Records all the events as a string, and captures rows of "data" (if asked to)
+class RecordingHandler: public JSONHandler {
+public:
+  std::string events;
+  bool captureRows;
+  bool inData;
+  std::vector<JSON> rows;
+
+  explicit RecordingHandler(bool capture = false): captureRows(capture), inData(false) {}
+
+  void onStartObject() { events += "{"; }
+  void onKey(const std::string &key) { events += "k:" + key + " "; inData = (key == "data"); }
+  void onEndObject() { events += "}"; }
+  void onStartArray() { events += "["; }
+  void onEndArray() { events += "]"; inData = false; }
+  void onString(const std::string &s) { events += "s:" + s + " "; }
+  void onInt64(int64_t x) { events += "i:" + boost::lexical_cast<std::string>(x) + " "; }
+  void onDouble(double x) { events += "d:" + JSON(x).toString() + " "; }
+  void onBoolean(bool x) { events += x ? "true " : "false "; }
+  void onNull() { events += "null "; }
+  bool captureValue(size_t depth) { return captureRows && inData && depth == 2; }
+  void onValue(JSON &value) { events += "row "; rows.push_back(std::move(value)); }
+};
+
+TEST(JSONTest, ReadEvents) {
+  const std::string str = " {\"a\": [1, -2.5, \"x\\ty\", true, false, null, {}, []], \"b\": {\"c\": 1e2}} tail";
+  RecordingHandler h;
+  const char *stop = JSON::readEvents(str.data(), str.data() + str.size(), h);
+  ASSERT_EQ(std::string(stop), " tail");
+  ASSERT_EQ(h.events, "{k:a [i:1 d:-2.5 s:x\ty true false null {}[]]k:b {k:c d:100 }}");
+
+  RecordingHandler scalar;
+  JSON::readEvents("12", scalar);
+  ASSERT_EQ(scalar.events, "i:12 ");
+
+  // Only rows of "data" are materialized
+  RecordingHandler rowHandler(true);
+  JSON::readEvents("{\"next\": null, \"data\": [[1, \"a\"], [2, \"b\", {\"c\": []}]], \"size\": 2}", rowHandler);
+  ASSERT_EQ(rowHandler.events, "{k:next null k:data [row row ]k:size i:2 }");
+  ASSERT_EQ(rowHandler.rows.size(), 2u);
+  ASSERT_EQ(rowHandler.rows[0], JSON::parse("[1, \"a\"]"));
+  ASSERT_EQ(rowHandler.rows[1], JSON::parse("[2, \"b\", {\"c\": []}]"));
+
+  const char *invalid[] = {"", "[1,]", "{\"a\" 1}", "[1 2]", "[\"abc", "{\"a\": [tru]}", "[01]"};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+    RecordingHandler bad(true);
+    ASSERT_THROW(JSON::readEvents(invalid[i], bad), JSONException) << invalid[i];
+  }
+}
+
+TEST(JSONTest, PushParser) {
+  std::vector<std::string> inputs;
+  inputs.push_back(" {\"a\": [1, -2.5e-3, \"x\\ty\\u00e9\\\"\", true, false, null, {}, [[]]], \"b\": {\"c\": 1E2, \"\": \"\"}} ");
+  inputs.push_back("12");
+  inputs.push_back("\"a string which is long enough to be stored out of line\"");
+  inputs.push_back("[null,true,false,-0,0.5]");
+
+  // Every possible split of input into two and three fragments
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const std::string &str = inputs[i];
+    const JSON expected = JSON::parse(str);
+    RecordingHandler expectedEvents;
+    JSON::readEvents(str, expectedEvents);
+    for (size_t a = 0; a <= str.size(); ++a) {
+      for (size_t b = a; b <= str.size(); b += (str.size() > 20) ? 7 : 1) {
+        JSONPushParser parser;
+        parser.feed(str.substr(0, a));
+        parser.feed(str.substr(a, b - a));
+        parser.feed(str.substr(b));
+        ASSERT_FALSE(parser.isFinished());
+        parser.finish();
+        ASSERT_TRUE(parser.isFinished());
+        ASSERT_EQ(parser.value(), expected) << str << " split at " << a << ", " << b;
+
+        RecordingHandler h;
+        JSONPushParser eventParser(h);
+        eventParser.feed(str.data(), a);
+        eventParser.feed(str.data() + a, str.size() - a);
+        eventParser.finish();
+        ASSERT_EQ(h.events, expectedEvents.events);
+        ASSERT_THROW(eventParser.value(), JSONException);
+      }
+    }
+  }
+
+  // One byte at a time, allocating from an arena, and capturing rows
+  {
+    const std::string str = "{\"next\": null, \"data\": [[1, \"a\"], [2, \"b\", {\"c\": []}]], \"size\": 2}";
+    JSONArena arena;
+    JSONPushParser parser(arena);
+    RecordingHandler rowHandler(true);
+    JSONPushParser rowParser(rowHandler);
+    for (size_t i = 0; i < str.size(); ++i) {
+      parser.feed(&str[i], 1);
+      rowParser.feed(&str[i], 1);
+    }
+    parser.finish();
+    rowParser.finish();
+    ASSERT_EQ(parser.value(), JSON::parse(str));
+    ASSERT_TRUE(parser.value().tag & JSON::IN_ARENA);
+    ASSERT_EQ(rowHandler.events, "{k:next null k:data [row row ]k:size i:2 }");
+    ASSERT_EQ(rowHandler.rows[1], JSON::parse("[2, \"b\", {\"c\": []}]"));
+    parser.reset();
+    parser.feed("[1]");
+    parser.finish();
+    ASSERT_EQ(parser.value(), JSON::parse("[1]"));
+  }
+
+  const char *invalid[] = {"", "  ", "[1,]", "{\"a\" 1}", "[1 2]", "[\"abc", "{\"a\": [tru]}", "[01]",
+                           "nul", "[1] 2", "12 x", "{\"a\":1", "[1", "{1:2}", "-", "[1.]"};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+    JSONPushParser parser;
+    ASSERT_THROW({
+      parser.feed(invalid[i], strlen(invalid[i]));
+      parser.finish();
+    }, JSONException) << invalid[i];
+    ASSERT_THROW(parser.feed("1"), JSONException);
+    parser.reset();
+    parser.feed("1");
+    parser.finish();
+    ASSERT_EQ(parser.value(), 1);
+  }
+}
+
+TEST(JSONTest, LazyDocument) {
+  const std::string str = " {\"url\": \"https://x/y\", \"headers\": {\"a\": \"b\"}, \"state\" : \"closed\",\n"
+                          " \"parts\": {\"1\": {\"state\": \"complete\", \"size\": 10}, \"2\": {\"state\": \"pending\"}},\n"
+                          " \"k\\\"ey\": [1, -2.5e3, \"s\", true, null, [], {}, [[0]]], \"dup\": 1, \"dup\": 2} ";
+  const JSON expected = JSON::parse(str);
+
+  LazyJSONDocument doc(str);
+  ASSERT_EQ(doc.type(), JSON_OBJECT);
+  ASSERT_EQ(doc.size(), expected.size() + 1); // Duplicate key is counted twice
+  ASSERT_EQ(doc["url"].get<std::string>(), "https://x/y");
+  ASSERT_EQ(doc["headers"].value(), expected["headers"]);
+  ASSERT_EQ(doc["state"].get<std::string>(), "closed");
+  ASSERT_TRUE(doc["parts"].has("1"));
+  ASSERT_FALSE(doc["parts"].has("3"));
+  ASSERT_EQ(doc["parts"]["1"]["size"].get<int>(), 10);
+  ASSERT_EQ(doc["parts"]["2"].toString(), "{\"state\": \"pending\"}");
+  ASSERT_EQ(doc["dup"].get<int>(), 2);
+  ASSERT_EQ(doc.value(), expected);
+
+  const LazyJSON arr = doc["k\"ey"];
+  ASSERT_EQ(arr.type(), JSON_ARRAY);
+  ASSERT_EQ(arr.size(), 8u);
+  const JSONValue types[] = {JSON_INTEGER, JSON_REAL, JSON_STRING, JSON_BOOLEAN, JSON_NULL, JSON_ARRAY, JSON_OBJECT, JSON_ARRAY};
+  for (size_t i = 0; i < arr.size(); ++i) {
+    ASSERT_EQ(arr[i].type(), types[i]);
+    ASSERT_EQ(arr[i].value(), expected["k\"ey"][i]);
+  }
+  ASSERT_EQ(arr[1].get<double>(), -2500.0);
+  ASSERT_EQ(arr[7][0][0].get<int>(), 0);
+  ASSERT_TRUE(arr.has(7));
+  ASSERT_FALSE(arr.has(8));
+  ASSERT_EQ(arr[5].size(), 0u);
+
+  JSONArena arena;
+  ASSERT_TRUE(doc["parts"].value(arena).tag & JSON::IN_ARENA);
+
+  ASSERT_THROW(doc["nope"], JSONException);
+  ASSERT_THROW(doc[0], JSONException);
+  ASSERT_THROW(arr[8], JSONException);
+  ASSERT_THROW(arr["a"], JSONException);
+  ASSERT_THROW(doc["url"].size(), JSONException);
+
+  LazyJSONDocument scalar("  12 ");
+  ASSERT_EQ(scalar.type(), JSON_INTEGER);
+  ASSERT_EQ(scalar.root().get<int>(), 12);
+  ASSERT_EQ(scalar.root().toString(), "12");
+
+  LazyJSONDocument empty;
+  ASSERT_EQ(empty.type(), JSON_UNDEFINED);
+  ASSERT_EQ(LazyJSON().value().type(), JSON_UNDEFINED);
+
+  std::string moved = "[\"abc\"]";
+  empty.read(std::move(moved));
+  ASSERT_EQ(empty[0].get<std::string>(), "abc");
+
+  const char *invalid[] = {"", "  ", "[1,]", "{\"a\" 1}", "[1 2]", "[\"abc", "{\"a\": [tru]}", "[01]", "{\"a\":1", "{1:2}"};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+    LazyJSONDocument doc;
+    ASSERT_THROW(doc.read(std::string(invalid[i])), JSONException) << invalid[i];
+    ASSERT_EQ(doc.type(), JSON_UNDEFINED);
+  }
+}
+
+TEST(JSONTest, SortedObjectStorage) {
+  // Keys are kept sorted, irrespective of the order of insertion
+  JSON j(JSON_OBJECT);
+  const char *keys[] = {"m", "b", "z", "a", "mm", "", "b"};
+  for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i)
+    j[keys[i]] = int(i);
+  ASSERT_EQ(j.size(), 6u);
+  ASSERT_EQ(j.toString(), "{\"\":5,\"a\":3,\"b\":6,\"m\":0,\"mm\":4,\"z\":2}");
+  ASSERT_EQ(j["b"], 6);
+  ASSERT_TRUE(j.has("mm"));
+  j.erase("mm");
+  ASSERT_FALSE(j.has("mm"));
+  ASSERT_EQ(j.insert("c", JSON(7)), 7);
+  ASSERT_EQ(j.toString(), "{\"\":5,\"a\":3,\"b\":6,\"c\":7,\"m\":0,\"z\":2}");
+
+  // References to members stay valid when other keys are inserted (or erased)
+  JSON o = JSON::parse("{\"b\": 1, \"c\": [1, 2, 3], \"d\": {\"e\": 4}}");
+  o["a"] = o["c"];
+  ASSERT_EQ(o["a"], o["c"]);
+  JSON &rb = o["b"];
+  const JSON &rd = o["d"];
+  o["a0"] = 2;
+  for (int i = 0; i < 100; ++i)
+    o["k" + boost::lexical_cast<std::string>(i)] = i;
+  o.erase("c");
+  o["cc"] = 3;
+  rb = "still valid";
+  ASSERT_EQ(o["b"], "still valid");
+  ASSERT_EQ(rd["e"], 4);
+  ASSERT_EQ(o.size(), 105u);
+  for (int i = 0; i < 100; i += 2)
+    o.erase("k" + boost::lexical_cast<std::string>(i));
+  for (int i = 0; i < 100; i += 2)
+    o["x" + boost::lexical_cast<std::string>(i)] = i; // Reuses slots of erased members
+  ASSERT_EQ(o.size(), 105u);
+  ASSERT_EQ(o["k99"], 99);
+  ASSERT_EQ(o["x98"], 98);
+  ASSERT_EQ(rb, "still valid");
+  const JSON oCopy(o);
+  ASSERT_EQ(oCopy, o);
+  ASSERT_EQ(oCopy.toString(), o.toString());
+
+  // All the parsers produce same (sorted) object; for duplicate keys the last value wins
+  const std::string str = "{\"z\": 1, \"y\": {\"b\": [2], \"a\": 3}, \"x\": 4, \"z\": 5, \"w\": {\"k\": 1, \"k\": {\"q\": 2}}}";
+  const std::string expected = "{\"w\":{\"k\":{\"q\":2}},\"x\":4,\"y\":{\"a\":3,\"b\":[2]},\"z\":5}";
+  ASSERT_EQ(JSON::parse(str).toString(), expected);
+  JSONArena arena;
+  ASSERT_EQ(JSON::parse(str, arena).toString(), expected);
+  JSONPushParser parser;
+  parser.feed(str);
+  parser.finish();
+  ASSERT_EQ(parser.value().toString(), expected);
+
+  // Copy of an object allocated from arena is on heap, and can outlive the arena
+  JSON copy;
+  {
+    JSONArena tmpArena;
+    const JSON parsed = JSON::parse(str, tmpArena);
+    copy = parsed;
+  }
+  ASSERT_EQ(copy.toString(), expected);
+
+  std::map<std::string, int> m;
+  m["b"] = 1;
+  m["a"] = 2;
+  ASSERT_EQ(JSON(m).toString(), "{\"a\":2,\"b\":1}");
+}
+
+TEST(JSONTest, StringDecoding) {
+  // Pieces of a json string: raw (serialized) form, and the decoded value
+  const char *pieces[][2] = {{"a", "a"}, {"0123456789abcdefghij", "0123456789abcdefghij"}, {"\\n", "\n"}, {"\\\"", "\""},
+                             {"\\\\", "\\"}, {"\\/", "/"}, {"\\t\\b\\f\\r", "\t\b\f\r"}, {"\\u00e9", "\xc3\xa9"}, {"\\u0041", "A"},
+                             {"\\ud83d\\ude00", "\xf0\x9f\x98\x80"}, {"\xc3\xa9", "\xc3\xa9"}, {"\xe2\x82\xac", "\xe2\x82\xac"},
+                             {"\xf0\x9f\x98\x80", "\xf0\x9f\x98\x80"}, {"\xc3(", "\xc3("}, {"\xed\xa0\x80", "\xed\xa0\x80"},
+                             {"\xc0\xaf", "\xc0\xaf"}, {"\xff", "\xff"}, {"\xf0\x9f\x98", "\xf0\x9f\x98"}};
+  const size_t numPieces = sizeof(pieces) / sizeof(pieces[0]);
+  unsigned seed = 7;
+  for (int iter = 0; iter < 3000; ++iter) {
+    std::string raw, decoded;
+    const int count = iter % 40;
+    for (int i = 0; i < count; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      // Mostly plain ASCII, so that long runs (and 16 byte blocks) are common
+      size_t k = (seed >> 16) % (numPieces * 3);
+      if (k >= numPieces)
+        k = (k % 2 == 0) ? 0 : 1;
+      raw += pieces[k][0];
+      decoded += pieces[k][1];
+    }
+    // Note: utf8::replace_invalid() does not handle a truncated sequence at the very end
+    raw += ".";
+    decoded += ".";
+    // Invalid UTF-8 is replaced (escape sequences always produce valid UTF-8)
+    std::string expected;
+    utf8::replace_invalid(decoded.begin(), decoded.end(), std::back_inserter(expected));
+
+    const std::string str = "[\"" + raw + "\", {\"" + raw + "\": 1}]";
+    const JSON j = JSON::parse(str);
+    ASSERT_EQ(j[0].get<std::string>(), expected) << raw;
+    ASSERT_TRUE(j[1].has(expected)) << raw;
+    JSONArena arena;
+    ASSERT_EQ(JSON::parse(str, arena)[0].get<std::string>(), expected) << raw;
+  }
+
+  // Illegal escape sequences are reported (even after a long run of ASCII)
+  const std::string padding(40, 'x');
+  const char *invalid[] = {"\\x", "\\u12", "\\u12g4", "\\ud800", "\\ud800\\u0041", "\\udc00", "\\"};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+    ASSERT_THROW(JSON::parse("\"" + std::string(invalid[i]) + "\""), JSONException) << invalid[i];
+    ASSERT_THROW(JSON::parse("[\"" + padding + invalid[i] + "\"]"), JSONException) << invalid[i];
+  }
+}
+
+TEST(JSONTest, Serializer) {
+  // Every special character, at every offset of a (longer than 16 bytes) string
+  const char *special[][2] = {{"\"", "\\\""}, {"\\", "\\\\"}, {"\n", "\\n"}, {"\t", "\\t"}, {"\b", "\\b"},
+                              {"\f", "\\f"}, {"\r", "\\r"}, {"\x01", "\\u0001"}, {"\x1f", "\\u001f"}, {"/", "/"},
+                              {"\x7f", "\x7f"}, {"\xc3\xa9", "\xc3\xa9"}, {" ", " "}};
+  for (size_t k = 0; k < sizeof(special) / sizeof(special[0]); ++k) {
+    for (size_t pos = 0; pos <= 40; ++pos) {
+      const std::string str = std::string(pos, 'a') + special[k][0] + std::string(40 - pos, 'b');
+      const std::string expected = "\"" + std::string(pos, 'a') + special[k][1] + std::string(40 - pos, 'b') + "\"";
+      ASSERT_EQ(JSON(str).toString(), expected);
+      ASSERT_EQ(JSON::parse(expected).get<std::string>(), str);
+    }
+  }
+  ASSERT_EQ(JSON(std::string("\0", 1)).toString(), "\"\\u0000\"");
+
+  // writeTo() appends to the buffer, and gives same output as write()/toString()
+  const JSON j = JSON::parse("{\"b\": [1, -2.5, true, false, null, \"x\\ny\"], \"a\": {}, \"c\\u0002\": []}");
+  const std::string expected = "{\"a\":{},\"b\":[1,-2.5,true,false,null,\"x\\ny\"],\"c\\u0002\":[]}";
+  ASSERT_EQ(j.toString(), expected);
+  std::ostringstream out;
+  j.write(out);
+  ASSERT_EQ(out.str(), expected);
+  std::string buf = "[";
+  j.writeTo(buf);
+  buf += ',';
+  j["b"].writeTo(buf);
+  buf += ']';
+  ASSERT_EQ(buf, "[" + expected + ",[1,-2.5,true,false,null,\"x\\ny\"]]");
+  ASSERT_EQ(JSON::parse(buf)[0], j);
+
+  ASSERT_THROW(JSON().writeTo(buf), JSONException);
+  ASSERT_THROW(JSON().toString(), JSONException);
+}
+
+struct BoundPart {
+  std::string state;
+  int64_t size;
+  BoundPart(): size(-1) {}
+};
+DX_JSON_FIELDS(BoundPart, state, size)
+
+struct BoundFile {
+  std::string id;
+  std::string state;
+  double ratio;
+  bool hidden;
+  std::vector<std::string> tags;
+  std::map<std::string, BoundPart> parts;
+  JSON details;
+  BoundFile(): ratio(0.0), hidden(false) {}
+};
+DX_JSON_FIELDS(BoundFile, id, state, ratio, hidden, tags, parts, details)
+
+TEST(JSONTest, Binding) {
+  const std::string desc = "{\"id\": \"file-xxxx\", \"class\": \"file\", \"properties\": {\"a\": [1, {\"b\": null}], \"c\": \"\\\"}\"},"
+                           " \"state\": \"open\", \"hidden\": true, \"ratio\": 1, \"tags\": [\"x\", \"y\\n\"], \"sponsored\": false,"
+                           " \"parts\": {\"1\": {\"state\": \"complete\", \"size\": 5242880, \"md5\": \"abc\"}, \"2\": {\"state\": \"pending\", \"size\": null}},"
+                           " \"details\": {\"k\": [1, 2.5]}, \"created\": 1.5e12}";
+  BoundFile f;
+  fromJSON(desc, f);
+  ASSERT_EQ(f.id, "file-xxxx");
+  ASSERT_EQ(f.state, "open");
+  ASSERT_EQ(f.ratio, 1.0);
+  ASSERT_TRUE(f.hidden);
+  ASSERT_EQ(f.tags.size(), 2u);
+  ASSERT_EQ(f.tags[1], "y\n");
+  ASSERT_EQ(f.parts.size(), 2u);
+  ASSERT_EQ(f.parts["1"].state, "complete");
+  ASSERT_EQ(f.parts["1"].size, 5242880);
+  ASSERT_EQ(f.parts["2"].size, -1); // null leaves the default
+  ASSERT_EQ(f.details, JSON::parse("{\"k\": [1, 2.5]}"));
+
+  // Same result when read from a LazyJSONDocument (in place), or a JSON value
+  LazyJSONDocument doc(desc);
+  BoundPart part;
+  fromJSON(doc["parts"]["1"], part);
+  ASSERT_EQ(part.size, 5242880);
+  BoundFile f2;
+  fromJSON(JSON::parse(desc).toString(), f2);
+  ASSERT_EQ(toJSONString(f2), toJSONString(f));
+
+  // Encoding, and round trip
+  const std::string encoded = toJSONString(f);
+  ASSERT_EQ(encoded, "{\"id\":\"file-xxxx\",\"state\":\"open\",\"ratio\":1,\"hidden\":true,\"tags\":[\"x\",\"y\\n\"],"
+                     "\"parts\":{\"1\":{\"state\":\"complete\",\"size\":5242880},\"2\":{\"state\":\"pending\",\"size\":-1}},"
+                     "\"details\":{\"k\":[1,2.5]}}");
+  ASSERT_EQ(JSON::parse(encoded)["parts"]["2"]["size"], -1);
+  BoundFile f3;
+  fromJSON(encoded, f3);
+  ASSERT_EQ(toJSONString(f3), encoded);
+
+  // Missing fields keep their values, and the last duplicate wins
+  BoundPart p2;
+  p2.state = "x";
+  fromJSON("{\"size\": 1, \"size\": 2}", p2);
+  ASSERT_EQ(p2.state, "x");
+  ASSERT_EQ(p2.size, 2);
+  std::vector<int> nums;
+  fromJSON("[1, 2.9, true]", nums);
+  ASSERT_EQ(nums, std::vector<int>({1, 2, 1}));
+  std::map<std::string, std::vector<double> > m;
+  fromJSON("{\"a\": [], \"b\": [0.5]}", m);
+  ASSERT_EQ(toJSONString(m), "{\"a\":[],\"b\":[0.5]}");
+
+  // Type mismatches, and invalid json (also in skipped values)
+  ASSERT_THROW(fromJSON("{\"id\": 1}", f), JSONException);
+  ASSERT_THROW(fromJSON("{\"size\": \"1\"}", p2), JSONException);
+  ASSERT_THROW(fromJSON("[1, 2]", p2), JSONException);
+  ASSERT_THROW(fromJSON("{\"state\": \"a\" \"size\": 1}", p2), JSONException);
+  ASSERT_THROW(fromJSON("{\"other\": [1 2]}", p2), JSONException);
+  ASSERT_THROW(fromJSON("{\"other\": {\"a\" 1}}", p2), JSONException);
+  ASSERT_THROW(fromJSON("{\"other\": tru}", p2), JSONException);
+  ASSERT_THROW(fromJSON("{\"other\": \"abc", p2), JSONException);
+  ASSERT_THROW(fromJSON("[1, 2", nums), JSONException);
+  ASSERT_THROW(fromJSON("[1,, 2]", nums), JSONException);
+}
+
+TEST(JSONTest, BinaryEncoding) {
+  const JSON j = JSON::parse("{\"b\": [1, -1, 23, 24, -25, 255, 256, 65536, 4294967296, 9223372036854775807, -9223372036854775808],"
+                             " \"a\": [1.0, -2.5, 1e300, 0.1, true, false, null, {}, []], \"\": \"\", \"s\": \"short\","
+                             " \"long string \\u00e9 with a multi-byte character\": {\"nested\": [[\"x\"]]}}");
+  std::string buf = "prefix";
+  j.writeBinary(buf);
+  ASSERT_EQ(buf.substr(0, 6), "prefix");
+
+  // Integers stay JSON_INTEGER, reals (even if integral) stay JSON_REAL
+  JSON k;
+  ASSERT_EQ(k.readBinary(buf.data() + 6, buf.data() + buf.size()), buf.data() + buf.size());
+  ASSERT_EQ(k, j);
+  ASSERT_EQ(k.toString(), j.toString());
+  ASSERT_EQ(k["a"][0].type(), JSON_REAL);
+  ASSERT_EQ(k["b"][0].type(), JSON_INTEGER);
+  ASSERT_EQ(k["b"][10].get<int64_t>(), std::numeric_limits<int64_t>::min());
+  JSONArena arena;
+  JSON inArena;
+  inArena.readBinary(buf.data() + 6, buf.data() + buf.size(), arena);
+  ASSERT_EQ(inArena, j);
+
+  // Values are encoded as CBOR (RFC 7049), with the shortest integer/length encoding
+  std::string small;
+  JSON::parse("{\"a\": [1, -1, 1.5, true, null]}").writeBinary(small);
+  ASSERT_EQ(small, std::string("\xa1\x61" "a" "\x85\x01\x20\xfb\x3f\xf8\0\0\0\0\0\0\xf5\xf6", 17));
+  small.clear();
+  JSON(int64_t(1000)).writeBinary(small);
+  ASSERT_EQ(small, "\x19\x03\xe8");
+
+  // CBOR from other encoders: float16/float32, tags, unsorted and duplicate keys
+  JSON other;
+  const std::string cbor("\xd9\xd9\xf7\xa3\x61" "b" "\xf9\x3e\x00\x61" "a" "\xfa\x3f\xc0\x00\x00\x61" "b" "\x02", 19);
+  ASSERT_EQ(other.readBinary(cbor.data(), cbor.data() + cbor.size()), cbor.data() + cbor.size());
+  ASSERT_EQ(other.toString(), "{\"a\":1.5,\"b\":2}");
+
+  // Invalid UTF-8 is replaced, same as by the text parser
+  const std::string badUTF8("\x62\xff" "a", 3);
+  other.readBinary(badUTF8.data(), badUTF8.data() + badUTF8.size());
+  ASSERT_EQ(other.get<std::string>(), JSON::parse("\"\xff" "a\"").get<std::string>());
+
+  // Truncated and unsupported input
+  for (size_t n = 6; n < buf.size(); ++n)
+    ASSERT_THROW(other.readBinary(buf.data() + 6, buf.data() + n), JSONException) << n;
+  ASSERT_EQ(other.type(), JSON_UNDEFINED);
+  const std::string invalid[] = {std::string("\x9b\xff\xff\xff\xff\xff\xff\xff\xff", 9), "\x9f\x01\xff", "\x42" "ab",
+                                 std::string("\xa1\x01\x02", 3), std::string("\x1b\x80\0\0\0\0\0\0\0", 9),
+                                 std::string("\xfb\x7f\xf0\0\0\0\0\0\0", 9), "\xf7", "\x1c"};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+    ASSERT_THROW(other.readBinary(invalid[i].data(), invalid[i].data() + invalid[i].size()), JSONException) << i;
+  ASSERT_THROW(JSON().writeBinary(buf), JSONException);
+
+  // Map length which overflows when counted in data items
+  const std::string hugeMap("\xbb\x80\0\0\0\0\0\0\0\x01\x01", 11);
+  ASSERT_THROW(other.readBinary(hugeMap.data(), hugeMap.data() + hugeMap.size()), JSONException);
+
+  // Any number of tags is skipped (without recursion)
+  const std::string tagged = std::string(100000, '\xc6') + "\x07";
+  other.readBinary(tagged.data(), tagged.data() + tagged.size());
+  ASSERT_EQ(other, 7);
+
+  // Keys out of order are sorted (the last one of duplicate keys is kept), same as by the text parser
+  std::string unordered = "\xb9\x0f\xa1", text = "{";
+  for (int i = 0; i < 4001; ++i) {
+    const std::string key = boost::lexical_cast<std::string>((i * 7919) % 4000);
+    unordered += "\x64" + std::string(4 - key.size(), '0') + key + "\x19" + char(i >> 8) + char(i & 0xff);
+    text += std::string(i ? ", " : "") + "\"" + std::string(4 - key.size(), '0') + key + "\": " + boost::lexical_cast<std::string>(i);
+  }
+  text += "}";
+  other.readBinary(unordered.data(), unordered.data() + unordered.size());
+  ASSERT_EQ(other, JSON::parse(text));
+  ASSERT_EQ(other.size(), 4000u);
+  ASSERT_EQ(other["0000"], 4000);
+}
+
+// Returns true if f() throws a JSONException
+template<typename F>
+static bool throwsJSONException(F f) {
+  try {
+    f();
+  } catch (JSONException &) {
+    return true;
+  }
+  return false;
+}
+
+TEST(JSONTest, NestingDepth) {
+  // Up to 1000 nested arrays/objects are accepted by all the readers, deeper input is rejected
+  for (int depth = 1000; depth <= 1001; ++depth) {
+    const std::string arrays = std::string(depth, '[') + std::string(depth, ']');
+    std::string objects;
+    for (int i = 0; i < depth; ++i)
+      objects += "{\"a\":";
+    objects += "1" + std::string(depth, '}');
+    const bool valid = (depth == 1000);
+    const std::string docs[] = {arrays, objects};
+    for (size_t d = 0; d < 2; ++d) {
+      const std::string &str = docs[d];
+      if (valid) {
+        ASSERT_NO_THROW(JSON::parse(str));
+      } else {
+        ASSERT_JSONEXCEPTION(JSON::parse(str));
+      }
+      RecordingHandler h;
+      ASSERT_EQ(valid, !throwsJSONException([&]() { JSON::readEvents(str, h); }));
+      JSONPushParser parser;
+      ASSERT_EQ(valid, !throwsJSONException([&]() { parser.feed(str); parser.finish(); }));
+      LazyJSONDocument lazy;
+      ASSERT_EQ(valid, !throwsJSONException([&]() { lazy.read(std::string(str)); }));
+    }
+    const std::string binary = std::string(depth, '\x81') + "\x01";
+    JSON j;
+    ASSERT_EQ(valid, !throwsJSONException([&]() { j.readBinary(binary.data(), binary.data() + binary.size()); }));
+  }
+  // Unterminated input does not overflow the stack either
+  ASSERT_JSONEXCEPTION(JSON::parse(std::string(1000000, '[')));
+}
+
+TEST(JSONTest, Hash) {
+  // Equal values have equal hashes, however they were built
+  JSON built(JSON_OBJECT);
+  built["z"] = JSON(JSON_ARRAY);
+  built["z"].push_back(1);
+  built["z"].push_back("a long string, not stored inline");
+  built["a"] = JSON(JSON_NULL);
+  built["m"] = true;
+  built["r"] = 2.5;
+  const std::string text = "{\"a\": null, \"m\": true, \"r\": 2.5, \"z\": [1, \"a long string, not stored inline\"]}";
+  const JSON parsed = JSON::parse(text);
+  JSONArena arena;
+  const JSON inArena = JSON::parse(text, arena);
+  ASSERT_EQ(parsed, built);
+  ASSERT_EQ(parsed.hash(), built.hash());
+  ASSERT_EQ(inArena.hash(), built.hash());
+  ASSERT_EQ(JSON(built).hash(), built.hash());
+  ASSERT_EQ(std::hash<JSON>()(built), static_cast<size_t>(built.hash()));
+
+  // Reals are compared with a tolerance, values which are equal (but not identical) usually have equal hashes
+  const double reals[][2] = {{1.0, 1.0 + JSON::getEpsilon()}, {0.1 + 0.2, 0.3}, {3.0, 3.0 + 2 * JSON::getEpsilon()},
+                             {0.0, -1e-300}, {0.0, -0.0}, {1e300, 1e300 * (1 + JSON::getEpsilon())}, {-7.25, -7.25 - 1e-15}};
+  for (size_t i = 0; i < sizeof(reals) / sizeof(reals[0]); ++i) {
+    ASSERT_EQ(JSON(reals[i][0]), JSON(reals[i][1])) << i;
+    ASSERT_EQ(JSON(reals[i][0]).hash(), JSON(reals[i][1]).hash()) << i;
+  }
+
+  // Different values (of all types) have different hashes
+  const char *values[] = {"null", "true", "false", "0", "1", "-1", "1.0", "\"\"", "\"0\"", "\"1\"", "\"abcdefgh\"", "\"abcdefgh\\u0000\"",
+                          "\"abcdefghi\"", "[]", "{}", "[0]", "[[]]", "[null]", "[1, 2]", "[2, 1]", "[[1], 2]", "[1, [2]]",
+                          "{\"a\": 1}", "{\"a\": 2}", "{\"b\": 1}", "{\"a\": [1]}", "{\"a\": 1, \"b\": 2}", "{\"a\": 2, \"b\": 1}",
+                          "{\"ab\": \"c\"}", "{\"a\": \"bc\"}", "[\"a\", \"b\"]", "[\"ab\"]", "{\"a\": null}", "{\"\": \"a\"}",
+                          "1.5", "2.5", "-1.5", "0.5", "1e-10", "1e300", "[1.5, \"x\"]", "[2.5, \"x\"]"};
+  std::unordered_map<JSON, size_t> seen;
+  std::set<uint64_t> hashes;
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+    ASSERT_TRUE(seen.insert(std::make_pair(JSON::parse(values[i]), i)).second) << values[i];
+    ASSERT_TRUE(hashes.insert(JSON::parse(values[i]).hash()).second) << values[i];
+  }
+  ASSERT_EQ(seen[JSON::parse("{\"b\": 2, \"a\": 1}")], 26u);
+  ASSERT_EQ(seen.size(), sizeof(values) / sizeof(values[0]));
+
+  // Hashes are stable (same in every process/platform), since they may be persisted
+  ASSERT_EQ(JSON::parse("[1, \"x\", {\"key\": null}]").hash(), 4740329722357367171ull);
+  ASSERT_EQ(JSON::parse("[0.5, -2.5e10]").hash(), 16335091349525754190ull);
+}
+
+TEST(JSONTest, CopyOnWrite) {
+  const std::string text = "{\"a\": [1, 2, {\"x\": \"a long string, not stored inline\"}], \"b\": {\"c\": [true]}, \"d\": 1}";
+  ASSERT_FALSE(JSON::getCopyOnWrite());
+  {
+    // Without copy-on-write, every copy is a deep copy
+    const JSON j = JSON::parse(text);
+    const JSON copy(j);
+    ASSERT_NE(copy.val.obj, j.val.obj);
+  }
+  JSON::setCopyOnWrite(true);
+
+  // Copies share the tree, modifications only copy the path being modified
+  const JSON original = JSON::parse(text);
+  JSON j(original);
+  const JSON &cj = j;
+  ASSERT_EQ(&cj["a"], &original["a"]);
+  j["a"][2]["x"] = "changed";
+  ASSERT_EQ(original, JSON::parse(text));
+  ASSERT_EQ(cj["a"][2]["x"], "changed");
+  ASSERT_NE(&cj["a"], &original["a"]);
+  ASSERT_EQ(cj["b"].val.obj, original["b"].val.obj); // Not on the modified path: still shared
+
+  JSON k(original);
+  k["a"].push_back(3);
+  k["b"].erase("c");
+  k["a"].erase(0);
+  ASSERT_EQ(k.toString(), "{\"a\":[2,{\"x\":\"a long string, not stored inline\"},3],\"b\":{},\"d\":1}");
+  ASSERT_EQ(original, JSON::parse(text));
+
+  // A value accessed through a non-const reference (or iterator) is never shared
+  // again, so modifications through the reference only affect that value
+  JSON m = JSON::parse(text);
+  JSON &a = m["a"];
+  JSON &x = m["a"][2]["x"];
+  JSON::object_iterator it = m["b"].object_begin();
+  const JSON snapshot(m);
+  a.push_back(4);
+  x = "modified";
+  it->second = JSON(JSON_NULL);
+  ASSERT_EQ(snapshot, JSON::parse(text));
+  ASSERT_EQ(m.toString(), "{\"a\":[1,2,{\"x\":\"modified\"},4],\"b\":{\"c\":null},\"d\":1}");
+
+  // Values in containers, and values built by the user
+  std::vector<JSON> copies(10, original);
+  copies[3]["d"] = 2;
+  JSON built(JSON_OBJECT);
+  built["list"] = copies;
+  JSON builtCopy(built);
+  builtCopy["list"][3]["d"] = 3;
+  ASSERT_EQ(built["list"][3]["d"], 2);
+  ASSERT_EQ(built["list"][4], original);
+  ASSERT_EQ(copies[4], original);
+
+  // Arena values are never shared
+  JSONArena arena;
+  const JSON inArena = JSON::parse(text, arena);
+  const JSON fromArena(inArena);
+  ASSERT_NE(fromArena.val.obj, inArena.val.obj);
+
+  // Copies can be made and modified in different threads
+  std::vector<JSON> results(4);
+  std::vector<std::thread*> threads;
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.push_back(new std::thread([&original, &results, i]() {
+      for (int n = 0; n < 1000; ++n) {
+        JSON c(original);
+        c["b"]["c"].push_back(n);
+        results[i] = c;
+      }
+    }));
+  }
+  for (size_t i = 0; i < threads.size(); ++i) {
+    threads[i]->join();
+    delete threads[i];
+    ASSERT_EQ(results[i]["b"]["c"].size(), 2u);
+  }
+  ASSERT_EQ(original, JSON::parse(text));
+  JSON::setCopyOnWrite(false);
+}
+
+TEST(JSONTest, JSONPath) {
+  const std::string text = "{\"parts\": {\"1\": {\"state\": \"complete\", \"md5\": \"aa\"}, \"2\": {\"state\": \"pending\"}, \"10\": {\"md5\": \"cc\"}},"
+                           " \"results\": [{\"id\": \"file-1\"}, {\"id\": \"file-2\", \"x\": [1, {\"id\": 3}]}, 5, {\"name\": \"id\"}],"
+                           " \"headers\": {\"a/b\": \"1\", \"c~d\": \"2\", \"\\u00e9\\\"\": \"3\", \"*\": \"4\"}, \"empty\": {}}";
+  const JSON j = JSON::parse(text);
+  LazyJSONDocument lazy(text);
+  struct {
+    const char *expr;
+    const char *expected;
+  } cases[] = {
+    {"/parts/*/md5", "[\"aa\",\"cc\"]"},
+    {"/parts/*/state", "[\"complete\",\"pending\"]"},
+    {"/results/*/id", "[\"file-1\",\"file-2\"]"},
+    {"/results/1/x/1/id", "[3]"},
+    {"/results/01", "[]"},
+    {"/results/4", "[]"},
+    {"/parts/10/md5", "[\"cc\"]"},
+    {"/headers/a~1b", "[\"1\"]"},
+    {"/headers/c~0d", "[\"2\"]"},
+    {"/headers/\xc3\xa9\"", "[\"3\"]"},
+    {"/headers/*", "[\"4\",\"1\",\"2\",\"3\"]"}, // Sorted by key
+    {"/*/*/id", "[\"file-1\",\"file-2\"]"},
+    {"/empty/*", "[]"},
+    {"/missing/x", "[]"},
+    {"/parts/1/state/x", "[]"},
+    {"", NULL}
+  };
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+    const JSONPath path(cases[i].expr);
+    ASSERT_EQ(path.expression(), cases[i].expr);
+    std::vector<const JSON*> dom;
+    path.select(j, dom);
+    JSON fromDOM(JSON_ARRAY);
+    for (size_t k = 0; k < dom.size(); ++k)
+      fromDOM.push_back(*dom[k]);
+    std::vector<JSON> streamed, fromLazy;
+    path.select(text, streamed);
+    path.select(lazy.root(), fromLazy);
+    if (cases[i].expected == NULL) {
+      ASSERT_EQ(dom.size(), 1u);
+      ASSERT_EQ(dom[0], &j);
+      ASSERT_EQ(streamed[0], j);
+      continue;
+    }
+    // Streaming visits object members in document order
+    if (std::string(cases[i].expr) == "/headers/*")
+      ASSERT_EQ(JSON(streamed).toString(), "[\"1\",\"2\",\"3\",\"4\"]");
+    else
+      ASSERT_EQ(JSON(streamed).toString(), cases[i].expected) << cases[i].expr;
+    ASSERT_EQ(fromDOM.toString(), cases[i].expected) << cases[i].expr;
+    ASSERT_EQ(JSON(fromLazy), JSON(streamed)) << cases[i].expr;
+    ASSERT_EQ(path.find(j), dom.empty() ? NULL : dom[0]);
+  }
+
+  // Path can be evaluated against any number of values
+  const JSONPath ids("/results/*/id");
+  std::vector<JSON> all;
+  const std::string two = "{\"results\": [{\"id\": 1}]} {\"results\": [{\"id\": 2}]}";
+  const char *next = ids.select(two.data(), two.data() + two.size(), all);
+  ids.select(next, two.data() + two.size(), all);
+  ASSERT_EQ(JSON(all).toString(), "[1,2]");
+
+  // Invalid expressions, and invalid input (even where nothing matches)
+  ASSERT_THROW(JSONPath("parts"), JSONException);
+  ASSERT_THROW(JSONPath("/a~2"), JSONException);
+  ASSERT_THROW(JSONPath("/a~"), JSONException);
+  const char *invalid[] = {"{\"results\": [{\"id\": 1}, ]}", "{\"other\": [1 2]}", "{\"results\": [{\"id\": 1}", "{\"a\" 1}", "[1]x"};
+  for (size_t i = 0; i < 4; ++i) {
+    all.clear();
+    all.push_back(JSON(7));
+    ASSERT_THROW(ids.select(invalid[i], all), JSONException) << invalid[i];
+    ASSERT_EQ(JSON(all).toString(), "[7]");
+  }
+  all.clear();
+  ASSERT_EQ(ids.select(invalid[4], invalid[4] + 4, all), invalid[4] + 3);
+}
+
+TEST(JSONTest, MappedFile) {
+  char path[] = "/tmp/test_dxjson_XXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  const std::string text = "{\"data\": [[1, \"a\"], [2, \"b\"]], \"next\": null} ";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << text;
+  }
+  ASSERT_EQ(JSON::parseFile(path), JSON::parse(text));
+
+  // Mapped contents can be read in place by any of the buffer readers
+  MappedFile file(path);
+  ASSERT_EQ(std::string(file.begin(), file.end()), text);
+  RecordingHandler rows(true);
+  ASSERT_EQ(JSON::readEvents(file.begin(), file.end(), rows), file.end() - 1);
+  ASSERT_EQ(rows.rows.size(), 2u);
+  std::vector<JSON> names;
+  JSONPath("/data/*/1").select(file.begin(), file.end(), names);
+  ASSERT_EQ(JSON(names).toString(), "[\"a\",\"b\"]");
+
+  // Binary encoded cache
+  std::string binary;
+  JSON::parse(text).writeBinary(binary);
+  file.close(); // Must not be truncated while mapped
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << binary;
+  }
+  ASSERT_TRUE(file.open(path));
+  JSON fromCache;
+  ASSERT_EQ(fromCache.readBinary(file.begin(), file.end()), file.end());
+  ASSERT_EQ(fromCache, JSON::parse(text));
+
+  // Empty (and missing) files
+  file.close();
+  { std::ofstream out(path, std::ios::trunc); }
+  ASSERT_TRUE(file.open(path));
+  ASSERT_EQ(file.size(), 0u);
+  ASSERT_THROW(JSON::parseFile(path), JSONException);
+  unlink(path);
+  ASSERT_FALSE(file.open(path));
+  ASSERT_EQ(file.size(), 0u);
+  ASSERT_THROW(MappedFile missing(path), std::runtime_error);
+  ASSERT_THROW(JSON::parseFile(path), JSONException);
+}
+
+TEST(JSONTest, MappedFileRegion) {
+  char path[] = "/tmp/test_dxjson_XXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  std::string text;
+  for (int i = 0; i < 20000; i++)
+    text.push_back(static_cast<char>('a' + (i * 7) % 26));
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << text;
+  }
+  MappedFile file;
+  // Offsets need not be page aligned
+  ASSERT_TRUE(file.open(path, 4095, 5000));
+  file.prefault();
+  ASSERT_EQ(std::string(file.begin(), file.end()), text.substr(4095, 5000));
+  ASSERT_TRUE(file.open(path, 0, 10));
+  ASSERT_EQ(std::string(file.begin(), file.end()), text.substr(0, 10));
+  // Region is truncated at end of file
+  ASSERT_TRUE(file.open(path, 19990, 100));
+  ASSERT_EQ(std::string(file.begin(), file.end()), text.substr(19990));
+  ASSERT_TRUE(file.open(path, 20000, 100));
+  ASSERT_EQ(file.size(), 0u);
+  ASSERT_TRUE(file.open(path, 8192, 0));
+  ASSERT_EQ(file.size(), 0u);
+  file.prefault(); // Nothing mapped
+  file.close();
+  unlink(path);
+  ASSERT_FALSE(file.open(path, 0, 10));
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
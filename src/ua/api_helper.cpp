@@ -180,7 +180,7 @@ string resolveProject(const string &projectSpec) {
     params["level"] = "UPLOAD";
 
     JSON findResult = systemFindProjects(params);
-    JSON projects = findResult["results"];
+    const JSON &projects = findResult["results"];
     for (unsigned i = 0; i < projects.size(); ++i) {
       matchingProjectIdToName[projects[i]["id"].get<string>()] = projectSpec;
     }
@@ -323,7 +323,7 @@ JSON findResumableFileObject(string project, string signature) {
     DXLOG(logINFO) << " failure while running findDataObjects with this input query: " << query.toString();
     throw;
   }
-  return output["results"];
+  return std::move(output["results"]);
 }
 
 void closeFileObject(const string &fileID) {
@@ -335,6 +335,13 @@ void removeFromProject(const string &projID, const string &objID) {
 }
 
 string getFileState(const string &fileID) {
-  JSON result = fileDescribe(fileID);
-  return result["state"].get<string>();
+  FileDescription desc;
+  describeFile(fileID, desc);
+  return desc.state;
+}
+
+void describeFile(const string &fileID, FileDescription &desc) {
+  LazyJSONDocument resp;
+  DXHTTPRequest("/" + fileID + "/describe", "{}", resp, true);
+  fromJSON(resp.root(), desc);
 }
@@ -19,8 +19,28 @@
 
 #include <string>
 #include <vector>
+#include <map>
 
 #include "dxjson/dxjson.h"
+#include "dxjson/json_binding.h"
+
+// Fields of a file description used by ua (decoded directly, see describeFile())
+struct FilePart {
+  std::string state;
+};
+
+struct FileDescription {
+  std::string state;
+  std::map<std::string, FilePart> parts; // Part index -> part
+
+  bool isPartComplete(const std::string &partIndex) const {
+    std::map<std::string, FilePart>::const_iterator it = parts.find(partIndex);
+    return (it != parts.end() && it->second.state == "complete");
+  }
+};
+
+DX_JSON_FIELDS(FilePart, state)
+DX_JSON_FIELDS(FileDescription, state, parts)
 
 std::string resolveProject(const std::string &projectSpec);
 
@@ -34,6 +54,9 @@ void closeFileObject(const std::string &fileID);
 
 std::string getFileState(const std::string &fileID);
 
+// Reads description of the file (fields other than those of FileDescription are skipped)
+void describeFile(const std::string &fileID, FileDescription &desc);
+
 dx::JSON findResumableFileObject(std::string project, std::string signature);
 
 void removeFromProject(const std::string &projID, const std::string &objID);
@@ -75,12 +75,13 @@ void get_empty_string_gzip(vector<char> &dest) {
 void Chunk::read() {
   const uint64_t len = end - start;
   data.clear();
-  data.resize(len);
+  mapped.close();
   if (len == 0) {
     // For empty file case (empty chunk)
     return;
   }
 #if WINDOWS_BUILD
+  data.resize(len);
   // For windows we use fseeko64() & fread(): since we
   // compile a 32bit UA version, and standard library functions
   // do not allow to read > 2GB locations in file
@@ -108,34 +109,28 @@ void Chunk::read() {
     throw runtime_error(msg.str());
   }
 #else
-  ifstream in(localFile.c_str(), ifstream::in | ifstream::binary);
-  if (!in) {
+  // The region is memory mapped rather than copied into "data" (see Chunk::mapped)
+  if (!mapped.open(localFile, start, len)) {
     ostringstream msg;
     msg << "file('" << localFile.c_str() << "') cannot be opened for reading..." <<
            "readdata failed on chunk " << (*this);
     throw runtime_error(msg.str());
   }
-  in.seekg(start);
-  if (!in.good()) {
-    ostringstream msg;
-    msg << "unable to seek to location '" << start << "' in the file '" << localFile.c_str()
-        << "' (fail bit = " << in.fail() << ", bad bit = " << in.bad() << ", eofbit = "
-        << in.eof() <<")... readdata failed on chunk " << (*this);
-    throw runtime_error(msg.str());
-  }
-  in.read(&(data[0]), len);
-  if (!in.good()) {
+  if (mapped.size() != len) {
     ostringstream msg;
     msg << "unable to read '" << len << "' bytes from location '" << start << "' in the file '"
-        << localFile.c_str() << "' (fail bit = " << in.fail() << ", bad bit = " << in.bad()
-        << ", eofbit = " << in.eof() <<")... readdata failed on chunk " << (*this);
+        << localFile.c_str() << "' (only " << mapped.size() << " bytes available)... readdata failed on chunk " << (*this);
+    mapped.close();
     throw runtime_error(msg.str());
   }
+  // Read from disk here (on a read thread), rather than on first access by
+  // the compress/upload threads
+  mapped.prefault();
 #endif
 }
 
 void Chunk::compress() {
-  int64_t sourceLen = data.size();
+  int64_t sourceLen = uploadSize();
   if (sourceLen == 0) {
     // Empty file case (empty chunk)
     return;
@@ -144,7 +139,7 @@ void Chunk::compress() {
   vector<char> dest(destLen);
 
   int compressStatus = gzCompress((Bytef *) (&(dest[0])), (uLongf *) &destLen,
-                                  (const Bytef *) (&(data[0])), (uLong) sourceLen,
+                                  (const Bytef *) uploadData(), (uLong) sourceLen,
                                   Z_DEFAULT_COMPRESSION);  // use default compression level value from ZLIB (usually 6)
 
   if (compressStatus == Z_MEM_ERROR) {
@@ -180,6 +175,17 @@ void Chunk::compress() {
     log ("Pushed empty string's gzip to 'dest' " + boost::lexical_cast<string>(count) + " number of times, Final length = " + boost::lexical_cast<string>(dest.size()) + " bytes");
   }
   data.swap(dest);
+  mapped.close();
+}
+
+const char* Chunk::uploadData() const {
+  if (mapped.size() > 0)
+    return mapped.begin();
+  return (data.empty()) ? NULL : &(data[0]);
+}
+
+size_t Chunk::uploadSize() const {
+  return (mapped.size() > 0) ? mapped.size() : data.size();
 }
 
 void checkConfigCURLcode(CURLcode code, char *errorBuffer) {
@@ -210,11 +216,11 @@ void checkPerformCURLcode(CURLcode code, char *errorBuffer) {
  */
 size_t curlReadFunction(void * ptr, size_t size, size_t nmemb, void * userdata) {
   Chunk * chunk = (Chunk *) userdata;
-  int64_t bytesLeft = chunk->data.size() - chunk->uploadOffset;
+  int64_t bytesLeft = chunk->uploadSize() - chunk->uploadOffset;
   size_t bytesToCopy = min<size_t>(bytesLeft, size * nmemb);
 
   if (bytesToCopy > 0) {
-    memcpy(ptr, &((chunk->data)[chunk->uploadOffset]), bytesToCopy);
+    memcpy(ptr, chunk->uploadData() + chunk->uploadOffset, bytesToCopy);
     chunk->uploadOffset += bytesToCopy;
   }
 
@@ -300,7 +306,8 @@ void Chunk::upload(Options &opt) {
       slist_resolved_ip = curl_slist_append(slist_resolved_ip, (hostName + ":443:" + resolvedIP).c_str());
       slist_resolved_ip = curl_slist_append(slist_resolved_ip, (hostName + ":80:" + resolvedIP).c_str());
       // Note: We don't remove this extra host name resolution info by setting "-HOST:PORT:IP" at the end,
-      // since we don't reuse the curl handle anyway
+      // since we don't reuse the curl handle anyway, and the handle does not share its DNS cache
+      // (see HttpShare::attach() below), so the entries do not leak to other handles
     } else {
       log("Not adding any explicit IP address using CURLOPT_RESOLVE. resolvedIP = '" + resolvedIP + "', hostName = '" + hostName + "'", dx::logWARNING);
     }
@@ -377,6 +384,15 @@ void Chunk::upload(Options &opt) {
     prog.uploadedBytes = 0;
     checkConfigCURLcode(curl_easy_setopt(curl, CURLOPT_PROGRESSDATA, &prog), errorBuffer);
 
+    // Share DNS, TLS session and connection caches with the other upload
+    // threads (and with dxcpp's API calls), instead of a new handshake per chunk.
+    // If the host is resolved explicitly (CURLOPT_RESOLVE), only TLS sessions are
+    // shared: a shared DNS cache would hand the chosen address to every other handle,
+    // and a shared connection cache would ignore it, defeating the round-robin
+    // between the addresses of the host.
+    const dx::HttpShare::Scope shareScope = (slist_resolved_ip != NULL) ? dx::HttpShare::TLS_SESSIONS_ONLY : dx::HttpShare::ALL;
+    checkConfigCURLcode(dx::HttpShare::attach(curl, shareScope), errorBuffer);
+
     /* Setting this option, since libcurl fails in multi-threaded environment otherwise */
     /* See: http://curl.haxx.se/libcurl/c/libcurl-tutorial.html#Multi-threading */
     checkConfigCURLcode(curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1l), errorBuffer);
@@ -405,7 +421,7 @@ void Chunk::upload(Options &opt) {
 
     // curl wants to know this (otherwise it uses chunked transfer), even
     // though we have set the content-length header above
-    checkConfigCURLcode(curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)data.size()), errorBuffer);
+    checkConfigCURLcode(curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)uploadSize()), errorBuffer);
 
     log("Starting curl_easy_perform...");
 
@@ -440,6 +456,7 @@ void Chunk::clear() {
   // memory from data into v; v will be destroyed when this function exits.
   vector<char> v;
   data.swap(v);
+  mapped.close();
   respData.clear();
 }
 
@@ -496,11 +513,11 @@ static bool attemptExplicitDNSResolve(const string &host) {
 pair<string, dx::JSON> Chunk::uploadURL(Options &opt) {
   dx::JSON params(dx::JSON_OBJECT);
   params["index"] = index + 1;  // minimum part index is 1
-  params["size"] = data.size();
-  params["md5"] = dx::getHexifiedMD5(data);
+  params["size"] = uploadSize();
+  params["md5"] = dx::getHexifiedMD5(reinterpret_cast<const unsigned char*>(uploadData()), uploadSize());
   log("Generating Upload URL for index = " + boost::lexical_cast<string>(params["index"].get<int>()));
   dx::JSON result = fileUpload(fileID, params);
-  pair<string, dx::JSON> toReturn = make_pair(result["url"].get<string>(), result["headers"]);
+  pair<string, dx::JSON> toReturn = make_pair(result["url"].get<string>(), std::move(result["headers"]));
   const string &url = toReturn.first;
   log("/" + fileID + "/upload call returned this url: " + url);
 
@@ -533,7 +550,7 @@ void Chunk::log(const string &message, const enum dx::LogLevel level) const {
 ostream &operator<<(ostream &out, const Chunk &chunk) {
   out << "[" << chunk.localFile << ":" << chunk.start << "-" << chunk.end
       << " -> " << chunk.fileID << "[" << chunk.index << "]"
-      << ", tries=" << chunk.triesLeft << ", data.size=" << chunk.data.size()
+      << ", tries=" << chunk.triesLeft << ", data.size=" << chunk.uploadSize()
       << ", compress="<< ((chunk.toCompress) ? "true": "false")
       << "]";
   return out;
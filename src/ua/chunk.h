@@ -23,6 +23,7 @@
 #include <boost/thread.hpp>
 
 #include "dxjson/dxjson.h"
+#include "dxutil/mapped_file.h"
 #include "dxcpp/dxlog.h"
 #include "dxcpp/bqueue.h"
 
@@ -87,9 +88,27 @@ public:
   /* Offset of the end of this chunk within the file */
   uint64_t end;
 
-  /* Chunk data -- the bytes to be uploaded */
+  /* Chunk data -- the bytes to be uploaded (unless "mapped" is set, see below) */
   std::vector<char> data;
 
+  /*
+   * The chunk's region of the local file, memory mapped by read() (which
+   * also reads it into memory, see MappedFile::prefault()). If the chunk is
+   * not compressed, it's uploaded straight from here (i.e., from the page
+   * cache), without first being copied into "data".
+   * Unlike a copy, the mapping reflects changes made to the file while the
+   * chunk is being processed:
+   *  - If the file is truncated, accessing the pages past its new end raises
+   *    SIGBUS (and crashes the upload agent).
+   *  - If the file is modified after the MD5 of the chunk is computed, the
+   *    bytes sent no longer match it: the part is rejected by the server (and
+   *    retried), or ends up with contents different from the original file.
+   * Local files must therefore not be modified while they are being uploaded
+   * (which was already required for the uploaded file to be consistent).
+   * Files that can't be mapped (e.g., pipes) are read into memory instead.
+   */
+  dx::MappedFile mapped;
+
   /* While uploading, the offset of the next byte to give to libcurl */
   uint64_t uploadOffset;
   
@@ -124,6 +143,10 @@ public:
   void upload(Options &opt);
   void clear();
 
+  /* The bytes to be uploaded: contents of "mapped" if set, else of "data" */
+  const char* uploadData() const;
+  size_t uploadSize() const;
+
   void log(const std::string &message, const dx::LogLevel level = dx::logINFO) const;
   friend std::ostream &operator<<(std::ostream &out, const Chunk &chunk);
 
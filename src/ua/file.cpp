@@ -186,13 +186,14 @@ unsigned int File::createChunks(dx::BlockingQueue<Chunk *> &queue, const int tri
     // 2. OR, Remote resumable target is already in "closing" or "closed" state.
     return 0;
   }
-  const dx::JSON desc = dx::fileDescribe(fileID);
+  FileDescription desc;
+  describeFile(fileID, desc);
   // sanity check
-  assert(desc["state"].get<string>() == "open");
+  assert(desc.state == "open");
 
   // Treat special case of empty file here
   if (size == 0) {
-    if (desc["parts"].has("1") && desc["parts"]["1"]["state"].get<string>() == "complete") {
+    if (desc.isPartComplete("1")) {
       DXLOG(logINFO) << "Part index 1 for fileID " << fileID << " is in complete state. Will not create an upload chunk for it.";
       atleastOnePartDone = true;
       return 0;
@@ -211,7 +212,7 @@ unsigned int File::createChunks(dx::BlockingQueue<Chunk *> &queue, const int tri
   for (uint64_t start = 0; start < size; start += chunkSize) {
     string partIndex = boost::lexical_cast<string>(countChunks + 1); // minimum part index is 1
     const uint64_t end = min(start + chunkSize, size);
-    if (desc["parts"].has(partIndex) && desc["parts"][partIndex]["state"].get<string>() == "complete") {
+    if (desc.isPartComplete(partIndex)) {
       DXLOG(logINFO) << "Part index " << partIndex << " for fileID " << fileID << " is in complete state. Will not create an upload chunk for it.";
       bytesUploaded += (end - start);
       atleastOnePartDone = true;
@@ -325,10 +325,10 @@ void compressChunks() {
   }
 }
 
-bool is_chunk_complete(Chunk *c, JSON &fileDescription) {
+bool is_chunk_complete(Chunk *c, const FileDescription &fileDescription) {
     string partIndex = boost::lexical_cast<string>(c->index + 1); // minimum part index is 1
 
-    return (fileDescription["parts"].has(partIndex) && fileDescription["parts"][partIndex]["state"].get<string>() == "complete");
+    return fileDescription.isPartComplete(partIndex);
 }
 
 void uploadChunks(vector<File> &files) {
@@ -350,7 +350,7 @@ void uploadChunks(vector<File> &files) {
 
       if (uploaded) {
         c->log("Upload succeeded!");
-        int64_t size_of_chunk = c->data.size(); // this can be different than (c->end - c->start) because of compression
+        int64_t size_of_chunk = c->uploadSize(); // this can be different than (c->end - c->start) because of compression
         c->clear();
         chunksFinished.produce(c);
         // Update number of bytes uploaded in parent file object
@@ -690,14 +690,14 @@ void setUserAgentString() {
 // chunks are marked as pending, and if so, we'll retry them.
 void check_for_complete_chunks(vector<File> &files) {
   for (int currCheckNum=0; currCheckNum < NUM_CHUNK_CHECKS; ++currCheckNum){
-    map<string, JSON> fileDescriptions;
+    map<string, FileDescription> fileDescriptions;
     while (!chunksFinished.empty()) {
       Chunk *c = chunksFinished.consume();
 
       // Cache file descriptions so we only have to do once per file,
       // not once per chunk.
       if (fileDescriptions.find(c->fileID) == fileDescriptions.end())
-        fileDescriptions[c->fileID] = fileDescribe(c->fileID);
+        describeFile(c->fileID, fileDescriptions[c->fileID]);
 
       if (!is_chunk_complete(c, fileDescriptions[c->fileID])) {
         // After the chunk was uploaded, it was cleared, removing the data
@@ -729,14 +729,14 @@ void check_for_complete_chunks(vector<File> &files) {
   // We have tried to upload incomplete chunks NUM_CHUNK_CHECKS times!
   // Check to see if there are any chunks still not complete and if so,
   // print warning.
-  map<string, JSON> fileDescriptions;
+  map<string, FileDescription> fileDescriptions;
   while (!chunksFinished.empty()) {
     Chunk *c = chunksFinished.consume();
 
     // Cache file descriptions so we only have to do once per file,
     // not once per chunk.
     if (fileDescriptions.find(c->fileID) == fileDescriptions.end())
-        fileDescriptions[c->fileID] = fileDescribe(c->fileID);
+        describeFile(c->fileID, fileDescriptions[c->fileID]);
 
     if (!is_chunk_complete(c, fileDescriptions[c->fileID])) {
         DXLOG(logUSERINFO) << "Chunk " << c->index << " of file " << c->fileID << " did not complete.  This file will not be accessible.  PLease try to upload this file again." << endl;